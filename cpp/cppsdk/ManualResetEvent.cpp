@@ -1,12 +1,164 @@
 #include "gsdkCommonPch.h"
 #include "ManualResetEvent.h"
 
+#ifdef GSDK_LINUX
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace Microsoft
 {
     namespace Azure
     {
         namespace Gaming
         {
+#ifdef GSDK_LINUX
+            namespace
+            {
+                // The futex word of both events. The waiters flag tells a Signal it has to wake someone.
+                constexpr int c_set = 1;
+                constexpr int c_unset = 0;
+                constexpr int c_unsetWithWaiters = 2;
+
+                // About a microsecond of polling, which catches a signal that follows the wait closely without a system call
+                constexpr int c_spinCount = 100;
+
+                static_assert(sizeof(std::atomic<int>) == sizeof(int), "The futex word must be a plain int");
+
+                void futexWait(std::atomic<int> &state, int expected, const timespec *timeout)
+                {
+                    syscall(SYS_futex, reinterpret_cast<int*>(&state), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+                }
+
+                void futexWake(std::atomic<int> &state, int count)
+                {
+                    syscall(SYS_futex, reinterpret_cast<int*>(&state), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+                }
+
+                void cpuRelax()
+                {
+#if defined(__x86_64__) || defined(__i386__)
+                    __builtin_ia32_pause();
+#endif
+                }
+
+                // Waits until tryPass succeeds, spinning first and then parking on the futex. tryPass gets whether this waiter
+                // has parked, since a waiter that parked may share the futex with others and must leave the waiters flag set.
+                template <typename TryPass>
+                bool waitForState(std::atomic<int> &state, TryPass tryPass, const std::chrono::steady_clock::time_point *deadline)
+                {
+                    // Spinning on a single core only holds off the thread that would signal
+                    static const bool spin = std::thread::hardware_concurrency() > 1;
+                    if (spin)
+                    {
+                        for (int i = 0; i < c_spinCount; ++i)
+                        {
+                            if (state.load(std::memory_order_relaxed) == c_set && tryPass(false))
+                            {
+                                return true;
+                            }
+                            cpuRelax();
+                        }
+                    }
+
+                    bool parked = false;
+                    while (true)
+                    {
+                        if (tryPass(parked))
+                        {
+                            return true;
+                        }
+
+                        timespec timeout;
+                        if (deadline != nullptr)
+                        {
+                            // FUTEX_WAIT timeouts are relative and measured on the monotonic clock, so wall clock changes don't move them
+                            std::chrono::nanoseconds remaining = *deadline - std::chrono::steady_clock::now();
+                            if (remaining.count() <= 0)
+                            {
+                                return false;
+                            }
+                            timeout.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+                            timeout.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+                        }
+
+                        int current = state.load();
+                        if (current == c_set)
+                        {
+                            continue;
+                        }
+                        if (current == c_unset && !state.compare_exchange_weak(current, c_unsetWithWaiters))
+                        {
+                            continue;
+                        }
+
+                        futexWait(state, c_unsetWithWaiters, deadline != nullptr ? &timeout : nullptr);
+                        parked = true;
+                    }
+                }
+            }
+
+            ManualResetEvent::ManualResetEvent() : m_state(c_unset)
+            {
+            }
+
+            ManualResetEvent::~ManualResetEvent()
+            {
+            }
+
+            void ManualResetEvent::Wait()
+            {
+                waitForState(m_state, [this](bool) { return m_state.load() == c_set; }, nullptr);
+            }
+
+            bool ManualResetEvent::Wait(unsigned long milliseconds)
+            {
+                std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+                return waitForState(m_state, [this](bool) { return m_state.load() == c_set; }, &deadline);
+            }
+
+            void ManualResetEvent::Signal()
+            {
+                if (m_state.exchange(c_set) == c_unsetWithWaiters)
+                {
+                    futexWake(m_state, INT_MAX);
+                }
+            }
+
+            void ManualResetEvent::Reset()
+            {
+                int open = c_set;
+                m_state.compare_exchange_strong(open, c_unset);
+            }
+
+            AutoResetEvent::AutoResetEvent() : m_state(c_unset)
+            {
+            }
+
+            AutoResetEvent::~AutoResetEvent()
+            {
+            }
+
+            bool AutoResetEvent::Wait(unsigned long milliseconds)
+            {
+                std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+                return waitForState(m_state, [this](bool parked)
+                {
+                    int signaled = c_set;
+                    return m_state.compare_exchange_strong(signaled, parked ? c_unsetWithWaiters : c_unset);
+                }, &deadline);
+            }
+
+            void AutoResetEvent::Signal()
+            {
+                if (m_state.exchange(c_set) == c_unsetWithWaiters)
+                {
+                    futexWake(m_state, 1);
+                }
+            }
+#else
             ManualResetEvent::ManualResetEvent() : m_isGateOpen(false)
             {
             }
@@ -43,6 +195,33 @@ namespace Microsoft
                 m_mutex.unlock();
             }
 
+            AutoResetEvent::AutoResetEvent() : m_isSignaled(false)
+            {
+            }
+
+            AutoResetEvent::~AutoResetEvent()
+            {
+            }
+
+            bool AutoResetEvent::Wait(unsigned long milliseconds)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (!m_condition.wait_for(lock, std::chrono::milliseconds(milliseconds), [&]() -> bool { return m_isSignaled; }))
+                {
+                    return false;
+                }
+                m_isSignaled = false;
+                return true;
+            }
+
+            void AutoResetEvent::Signal()
+            {
+                m_mutex.lock();
+                m_isSignaled = true;
+                m_mutex.unlock();
+                m_condition.notify_one();
+            }
+#endif
         }
     }
-}
\ No newline at end of file
+}
@@ -5,6 +5,7 @@
 #include <chrono>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
 
 namespace Microsoft
 {
@@ -12,12 +13,20 @@ namespace Microsoft
     {
         namespace Gaming
         {
+            // On Linux both events are a futex word: Signal and Reset are single atomic operations, and only a Signal
+            // with parked waiters makes a system call. Waits spin briefly before parking, and time out on the steady clock.
+            // Elsewhere they fall back to a mutex and condition variable.
+
             class ManualResetEvent
             {
             private:
+#ifdef GSDK_LINUX
+                std::atomic<int> m_state; // Open, Closed or ClosedWithWaiters
+#else
                 bool m_isGateOpen;
                 std::mutex m_mutex;
                 std::condition_variable m_condition;
+#endif
 
             public:
                 ManualResetEvent();
@@ -39,6 +48,30 @@ namespace Microsoft
                 void Reset();
             };
 
+            // Like a ManualResetEvent whose gate closes again as soon as one wait gets through it,
+            // so a Signal that arrives while the waiter is busy is never lost to a later Reset.
+            class AutoResetEvent
+            {
+            private:
+#ifdef GSDK_LINUX
+                std::atomic<int> m_state; // Signaled, Unsignaled or UnsignaledWithWaiters
+#else
+                bool m_isSignaled;
+                std::mutex m_mutex;
+                std::condition_variable m_condition;
+#endif
+
+            public:
+                AutoResetEvent();
+                ~AutoResetEvent();
+
+                // Blocks until the event is signaled, and unsignals it again for the next wait.
+                // Returns false if there was a timeout, true if the event was signaled.
+                bool Wait(unsigned long milliseconds);
+
+                // Lets one wait through. Signals are not counted: several before a wait let only that one through.
+                void Signal();
+            };
         }
     }
-}
\ No newline at end of file
+}
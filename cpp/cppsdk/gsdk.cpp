@@ -12,16 +12,23 @@ namespace Microsoft
         namespace Gaming
         {
             constexpr int c_minHeartbeatIntervalMs = 1000;
+            constexpr int c_defaultLongPollWaitSeconds = 30;
+            constexpr int c_longPollGraceMs = 5000; // On top of the wait, for the agent to answer once it stops holding
             std::unique_ptr<GSDKInternal> GSDKInternal::m_instance = nullptr;
+            std::atomic<GSDKInternal*> GSDKInternal::m_instancePtr(nullptr);
             std::mutex GSDKInternal::m_gsdkInitMutex;
             volatile long long GSDKInternal::m_exitStatus = 0;
+            std::atomic<long long> GSDKInternal::m_milestoneTimes[static_cast<int>(LifecycleMilestone::Count)];
             std::mutex GSDKInternal::m_logLock;
             std::ofstream GSDKInternal::m_logFile;
             bool GSDKInternal::m_debug = false;
             std::unique_ptr<Configuration> GSDKInternal::testConfiguration = nullptr;
 
-            GSDKInternal::GSDKInternal() : m_transitionToActiveEvent(), m_signalHeartbeatEvent(), m_initialPlayers()
+            GSDKInternal::GSDKInternal() : m_transitionToActiveEvent(), m_signalHeartbeatEvent(), m_initialPlayers(), m_sessionConfigHash(0), m_hasSessionConfigHash(false), m_configVersion(0)
             {
+                // Also covers the implicit start from the other GSDK methods
+                recordMilestone(LifecycleMilestone::StartEntered);
+
                 // Need to setup the config first, as that tells us where to log
                 Configuration* config = nullptr;
 
@@ -37,55 +44,56 @@ namespace Microsoft
                 else
                 {
                     std::string file_name = cGSDKUtils::getEnvironmentVariable("GSDK_CONFIG_FILE");
-                    std::ifstream is(file_name, std::ifstream::in);
+                    cMappedFile configFile(file_name);
 
                     // If the configuration file is not there, we'll get our config from environment variables
-                    if (is.fail())
+                    if (!configFile.isOpen())
                     {
                         configSmrtPtr = std::make_unique<EnvironmentVariableConfiguration>();
                     }
                     else
                     {
-                        configSmrtPtr = std::make_unique<JsonFileConfiguration>(file_name);
+                        configSmrtPtr = std::make_unique<JsonFileConfiguration>(configFile.data(), configFile.size());
                     }
                     config = configSmrtPtr.get();
                 }
 
-                std::unordered_map<std::string, std::string> gameCerts = config->getGameCertificates();
+                const std::unordered_map<std::string, std::string> &gameCerts = config->getGameCertificates();
                 for (auto it = gameCerts.begin(); it != gameCerts.end(); ++it)
                 {
-                    m_configSettings[it->first] = it->second;
+                    setConfigSetting(it->first, it->second);
                 }
 
-                std::unordered_map<std::string, std::string> metadata = config->getBuildMetadata();
+                const std::unordered_map<std::string, std::string> &metadata = config->getBuildMetadata();
                 for (auto it = metadata.begin(); it != metadata.end(); ++it)
                 {
-                    m_configSettings[it->first] = it->second;
+                    setConfigSetting(it->first, it->second);
                 }
 
-                std::unordered_map<std::string, std::string> ports = config->getGamePorts();
+                const std::unordered_map<std::string, std::string> &ports = config->getGamePorts();
                 for (auto it = ports.begin(); it != ports.end(); ++it)
                 {
-                    m_configSettings[it->first] = it->second;
+                    setConfigSetting(it->first, it->second);
                 }
 
-                m_configSettings[GSDK::HEARTBEAT_ENDPOINT_KEY] = config->getHeartbeatEndpoint();
-                m_configSettings[GSDK::SERVER_ID_KEY] = config->getServerId();
-                m_configSettings[GSDK::LOG_FOLDER_KEY] = config->getLogFolder();
-                m_configSettings[GSDK::SHARED_CONTENT_FOLDER_KEY] = config->getSharedContentFolder();
-                m_configSettings[GSDK::CERTIFICATE_FOLDER_KEY] = config->getCertificateFolder();
-                m_configSettings[GSDK::TITLE_ID_KEY] = config->getTitleId();
-                m_configSettings[GSDK::BUILD_ID_KEY] = config->getBuildId();
-                m_configSettings[GSDK::REGION_KEY] = config->getRegion();
-                m_configSettings[GSDK::PUBLIC_IP_V4_ADDRESS_KEY] = config->getPublicIpV4Address();
-                m_configSettings[GSDK::FULLY_QUALIFIED_DOMAIN_NAME_KEY] = config->getFullyQualifiedDomainName();
-
-                if (m_configSettings[GSDK::HEARTBEAT_ENDPOINT_KEY].empty() || m_configSettings[GSDK::SERVER_ID_KEY].empty())
+                setConfigSetting(GSDK::HEARTBEAT_ENDPOINT_KEY, config->getHeartbeatEndpoint());
+                setConfigSetting(GSDK::SERVER_ID_KEY, config->getServerId());
+                setConfigSetting(GSDK::LOG_FOLDER_KEY, config->getLogFolder());
+                setConfigSetting(GSDK::SHARED_CONTENT_FOLDER_KEY, config->getSharedContentFolder());
+                setConfigSetting(GSDK::CERTIFICATE_FOLDER_KEY, config->getCertificateFolder());
+                setConfigSetting(GSDK::TITLE_ID_KEY, config->getTitleId());
+                setConfigSetting(GSDK::BUILD_ID_KEY, config->getBuildId());
+                setConfigSetting(GSDK::REGION_KEY, config->getRegion());
+                setConfigSetting(GSDK::PUBLIC_IP_V4_ADDRESS_KEY, config->getPublicIpV4Address());
+                setConfigSetting(GSDK::FULLY_QUALIFIED_DOMAIN_NAME_KEY, config->getFullyQualifiedDomainName());
+
+                if (configValue(ConfigKey::HeartbeatEndpoint).empty() || configValue(ConfigKey::ServerId).empty())
                 {
                     throw GSDKInitializationException("Heartbeat endpoint and Server id are required configuration values.");
                 }
 
                 m_connectionInfo = config->getGameServerConnectionInfo();
+                buildGamePortIndex(ports);
 
                 // We don't want to write files in our UTs
                 if (config->shouldLog())
@@ -99,8 +107,8 @@ namespace Microsoft
                 GSDKLogMethod method_logger(__func__);
                 try
                 {
-                    std::string gsmsBaseUrl = m_configSettings[GSDK::HEARTBEAT_ENDPOINT_KEY];
-                    std::string instanceId = m_configSettings[GSDK::SERVER_ID_KEY];
+                    std::string gsmsBaseUrl = configValue(ConfigKey::HeartbeatEndpoint);
+                    std::string instanceId = configValue(ConfigKey::ServerId);
 
                     GSDK::logMessage("VM Agent Endpoint: " + gsmsBaseUrl);
                     GSDK::logMessage("Instance Id: " + instanceId);
@@ -118,14 +126,33 @@ namespace Microsoft
                     m_curlHttpHeaders = nullptr;
                     m_curlHttpHeaders = curl_slist_append(m_curlHttpHeaders, "Accept: application/json");
                     m_curlHttpHeaders = curl_slist_append(m_curlHttpHeaders, "Content-Type: application/json; charset=utf-8");
+                    m_curlNegotiatingHttpHeaders = nullptr;
+                    m_curlNegotiatingHttpHeaders = curl_slist_append(m_curlNegotiatingHttpHeaders, "Accept: application/msgpack, application/json;q=0.9");
+                    m_curlNegotiatingHttpHeaders = curl_slist_append(m_curlNegotiatingHttpHeaders, "Content-Type: application/json; charset=utf-8");
+                    m_curlMessagePackHttpHeaders = nullptr;
+                    m_curlMessagePackHttpHeaders = curl_slist_append(m_curlMessagePackHttpHeaders, "Accept: application/msgpack, application/json;q=0.9");
+                    m_curlMessagePackHttpHeaders = curl_slist_append(m_curlMessagePackHttpHeaders, "Content-Type: application/msgpack");
+
+                    // Agents that only speak JSON ignore the offer, so it is on unless turned off
+                    bool offerMessagePack = cGSDKUtils::getEnvironmentVariable("GSDK_HEARTBEAT_ENCODING") != "json";
+                    m_heartbeatEncoding = offerMessagePack ? HeartbeatEncoding::Negotiating : HeartbeatEncoding::Json;
+
+                    // StandingBy heartbeats ask the agent to hold them until the operation changes (RFC 7240's "wait" preference).
+                    // Agents that don't long poll ignore the header and answer straight away, which leaves regular polling.
+                    std::string longPollWait = cGSDKUtils::getEnvironmentVariable("GSDK_HEARTBEAT_LONG_POLL_SECONDS");
+                    m_longPollWaitSeconds = longPollWait.empty() ? c_defaultLongPollWaitSeconds : (std::max)(0, atoi(longPollWait.c_str()));
+                    m_curlLongPollHttpHeader = curl_slist_append(nullptr, ("Prefer: wait=" + std::to_string(m_longPollWaitSeconds)).c_str());
+                    m_isLongPolling = false;
+                    m_longPollApplied = false;
                     m_curlHandle = curl_easy_init();
 
                     m_transitionToActiveEvent.Reset();
-                    m_signalHeartbeatEvent.Reset();
 
                     // we might not want to heartbeat in our UTs
                     m_keepHeartbeatRunning = config->shouldHeartbeat();
                     m_heartbeatThread = std::thread(&GSDKInternal::heartbeatThreadFunc, this);
+
+                    recordMilestone(LifecycleMilestone::StartReturned);
                 }
                 catch (const std::exception& ex)
                 {
@@ -138,6 +165,62 @@ namespace Microsoft
             {
                 m_keepHeartbeatRunning = false;
                 m_heartbeatThread.join();
+                writeLifecycleTimeline();
+
+                // Last, so the heartbeat thread could still reach this instance while it was stopping
+                GSDKInternal* self = this;
+                m_instancePtr.compare_exchange_strong(self, nullptr);
+            }
+
+            void GSDKInternal::recordMilestone(LifecycleMilestone milestone)
+            {
+                // Only the first time counts, so a repeat never moves a milestone
+                long long notReached = 0;
+                m_milestoneTimes[static_cast<int>(milestone)].compare_exchange_strong(notReached, std::chrono::steady_clock::now().time_since_epoch().count());
+            }
+
+            void GSDKInternal::writeLifecycleTimeline()
+            {
+                if (m_timelinePath.empty())
+                {
+                    return;
+                }
+
+                std::vector<LifecycleEvent> timeline = GSDK::getLifecycleTimeline();
+
+                Json::Value timelineJson;
+                {
+                    std::lock_guard<std::mutex> lock(m_configMutex);
+                    timelineJson["titleId"] = configValue(ConfigKey::TitleId);
+                    timelineJson["buildId"] = configValue(ConfigKey::BuildId);
+                    timelineJson["region"] = configValue(ConfigKey::Region);
+                    timelineJson["serverId"] = configValue(ConfigKey::ServerId);
+                    timelineJson["sessionId"] = configValue(ConfigKey::SessionId);
+                }
+
+                // The wall clock time of the first milestone, to line timelines up with other logs
+                if (!timeline.empty())
+                {
+                    auto sinceFirst = std::chrono::steady_clock::now() - timeline.front().m_time;
+                    time_t firstTime = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now() - std::chrono::duration_cast<std::chrono::system_clock::duration>(sinceFirst));
+                    char firstTimeUtc[32];
+                    strftime(firstTimeUtc, sizeof(firstTimeUtc), "%Y-%m-%dT%H:%M:%SZ", gmtime(&firstTime));
+                    timelineJson["startTimeUtc"] = firstTimeUtc;
+                }
+
+                Json::Value &milestones = timelineJson["milestones"] = Json::Value(Json::arrayValue);
+                for (const LifecycleEvent &event : timeline)
+                {
+                    Json::Value milestone;
+                    milestone["name"] = event.m_name;
+                    milestone["elapsedMs"] = event.m_elapsedMs;
+                    milestones.append(milestone);
+                }
+
+                // Written whole each time, so the last write has every milestone reached
+                std::lock_guard<std::mutex> lock(m_timelineMutex);
+                std::ofstream timelineFile(m_timelinePath.c_str(), std::ofstream::out | std::ofstream::trunc);
+                timelineFile << timelineJson.toStyledString();
             }
 
 			//Do not need to acquire lock for configuration becase startLog is only called from the constructor.
@@ -148,8 +231,9 @@ namespace Microsoft
                 {
                     return;
                 }
-                std::string logFile = "GSDK_output_" + std::to_string((unsigned long long)time(nullptr)) + ".txt";
-                std::string logFolder = m_configSettings[GSDK::LOG_FOLDER_KEY];
+                std::string logTime = std::to_string((unsigned long long)time(nullptr));
+                std::string logFile = "GSDK_output_" + logTime + ".txt";
+                std::string logFolder = configValue(ConfigKey::LogFolder);
                 if (!logFolder.empty() && !cGSDKUtils::createDirectoryIfNotExists(logFolder)) // If we couldn't successfully create the path, just use the current directory
                 {
                     logFolder = "";
@@ -167,20 +251,32 @@ namespace Microsoft
 #endif
                 std::string logPath = logFolder + logFile;
                 m_logFile.open(logPath.c_str(), std::ofstream::out);
+                m_timelinePath = logFolder + "GSDK_timeline_" + logTime + ".json";
             }
 
             void GSDKInternal::heartbeatThreadFunc()
             {
+                int waitMs = m_nextHeartbeatIntervalMs;
                 while (m_keepHeartbeatRunning)
                 {
-                    if (m_signalHeartbeatEvent.Wait(m_nextHeartbeatIntervalMs))
+                    // Auto-reset, so a transition signaled while this heartbeat is in flight still gets its own early heartbeat
+                    if (m_signalHeartbeatEvent.Wait(waitMs))
                     {
                         if (m_debug) GSDK::logMessage("State transition signaled an early heartbeat.");
-                        m_signalHeartbeatEvent.Reset(); // We've handled this signal, so reset the event
                     }
 
+                    auto sendTime = std::chrono::steady_clock::now();
                     sendHeartbeat();
                     receiveHeartbeatResponse();
+                    waitMs = m_nextHeartbeatIntervalMs;
+
+                    // A held heartbeat already waited for the operation to change, so the next one is sent straight away.
+                    // An agent that answers long polls early still gets them no more often than the minimum interval.
+                    if (m_longPollApplied && m_heartbeatRequest.m_currentGameState == GameState::StandingBy)
+                    {
+                        long long heldMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sendTime).count();
+                        waitMs = heldMs < c_minHeartbeatIntervalMs ? static_cast<int>(c_minHeartbeatIntervalMs - heldMs) : 0;
+                    }
                 }
             }
 
@@ -192,34 +288,94 @@ namespace Microsoft
                 return (blockSize * blockCount);
             }
 
+            size_t GSDKInternal::curlReceiveHeader(char* buffer, size_t blockSize, size_t blockCount, void* userData)
+            {
+                static const char preferenceApplied[] = "preference-applied:";
+                const size_t length = blockSize * blockCount;
+                const size_t nameLength = sizeof(preferenceApplied) - 1;
+
+                if (length > nameLength && std::equal(preferenceApplied, preferenceApplied + nameLength, buffer, [](char a, char b) { return a == tolower(b); }))
+                {
+                    std::string value(buffer + nameLength, length - nameLength);
+                    if (value.find("wait") != std::string::npos)
+                    {
+                        static_cast<GSDKInternal*>(userData)->m_longPollApplied = true;
+                    }
+                }
+                return length;
+            }
+
+            int GSDKInternal::curlLongPollProgress(void* userData, curl_off_t, curl_off_t, curl_off_t, curl_off_t)
+            {
+                // Abandons a held heartbeat when the GSDK shuts down, instead of making the destructor wait out the hold
+                return static_cast<GSDKInternal*>(userData)->m_keepHeartbeatRunning ? 0 : 1;
+            }
+
             void GSDKInternal::resetCurl()
             {
                 curl_easy_reset(m_curlHandle);
                 curl_easy_setopt(m_curlHandle, CURLOPT_URL, m_heartbeatUrl.c_str());
-                curl_easy_setopt(m_curlHandle, CURLOPT_HTTPHEADER, m_curlHttpHeaders);
+                curl_slist *headers;
+                switch (m_heartbeatEncoding)
+                {
+                case HeartbeatEncoding::Negotiating:
+                    headers = m_curlNegotiatingHttpHeaders;
+                    break;
+                case HeartbeatEncoding::MessagePack:
+                    headers = m_curlMessagePackHttpHeaders;
+                    break;
+                default:
+                    headers = m_curlHttpHeaders;
+                }
+
+                if (m_isLongPolling)
+                {
+                    m_curlLongPollHttpHeader->next = headers;
+                    headers = m_curlLongPollHttpHeader;
+                    curl_easy_setopt(m_curlHandle, CURLOPT_TIMEOUT_MS, static_cast<long>(m_longPollWaitSeconds) * 1000 + c_longPollGraceMs);
+                    curl_easy_setopt(m_curlHandle, CURLOPT_XFERINFOFUNCTION, curlLongPollProgress);
+                    curl_easy_setopt(m_curlHandle, CURLOPT_XFERINFODATA, this);
+                    curl_easy_setopt(m_curlHandle, CURLOPT_NOPROGRESS, 0L);
+                }
+
+                curl_easy_setopt(m_curlHandle, CURLOPT_HTTPHEADER, headers);
                 curl_easy_setopt(m_curlHandle, CURLOPT_WRITEFUNCTION, curlReceiveData);
+                curl_easy_setopt(m_curlHandle, CURLOPT_HEADERFUNCTION, curlReceiveHeader);
+                curl_easy_setopt(m_curlHandle, CURLOPT_HEADERDATA, this);
             }
 
             void GSDKInternal::sendHeartbeat()
             {
+                m_isLongPolling = m_longPollWaitSeconds > 0 && m_heartbeatRequest.m_currentGameState == GameState::StandingBy;
+                m_longPollApplied = false;
                 resetCurl();
                 m_receivedData = "";
                 curl_easy_setopt(m_curlHandle, CURLOPT_CUSTOMREQUEST, "PATCH");
-                std::string request = encodeHeartbeatRequest();
-                curl_easy_setopt(m_curlHandle, CURLOPT_POSTFIELDS, request.c_str());
+                if (m_heartbeatRequest.m_currentGameState == GameState::StandingBy)
+                {
+                    recordMilestone(LifecycleMilestone::StandingBySent);
+                }
+                std::string request = (m_heartbeatEncoding == HeartbeatEncoding::MessagePack) ? cMessagePack::encode(buildHeartbeatRequest()) : encodeHeartbeatRequest();
+                curl_easy_setopt(m_curlHandle, CURLOPT_POSTFIELDS, request.data());
+                curl_easy_setopt(m_curlHandle, CURLOPT_POSTFIELDSIZE, static_cast<long>(request.size())); // MessagePack may contain zero bytes
                 curl_easy_perform(m_curlHandle);
             }
 
             std::string GSDKInternal::encodeHeartbeatRequest()
+            {
+                return buildHeartbeatRequest().toStyledString();
+            }
+
+            Json::Value GSDKInternal::buildHeartbeatRequest()
             {
                 Json::Value jsonHeartbeatRequest;
 
                 jsonHeartbeatRequest["CurrentGameState"] = GameStateNames[static_cast<int>(m_heartbeatRequest.m_currentGameState)];
 
-                auto temp = m_healthCallback;
+                auto temp = m_healthCallback.get();
                 if (temp != nullptr)
                 {
-                    m_heartbeatRequest.m_isGameHealthy = temp();
+                    m_heartbeatRequest.m_isGameHealthy = (*temp)();
                 }
                 jsonHeartbeatRequest["CurrentGameHealth"] = m_heartbeatRequest.m_isGameHealthy ? "Healthy" : "Unhealthy";
 
@@ -232,7 +388,7 @@ namespace Microsoft
                 }
                 jsonHeartbeatRequest["CurrentPlayers"] = jsonConnectedPlayerInfo;
 
-                return jsonHeartbeatRequest.toStyledString();
+                return jsonHeartbeatRequest;
             }
 
             std::tm GSDKInternal::parseDate(const std::string& dateStr) // note: this code only supports ISO 8601 UTC date-times in the format yyyy-mm-ddThh:mm:ssZ
@@ -262,13 +418,22 @@ namespace Microsoft
 
             void GSDKInternal::setState(GameState state)
             {
-                std::lock_guard<std::mutex> lock(m_stateMutex);
-
-                if (m_heartbeatRequest.m_currentGameState != state)
+                GSDKEvent stateChange(GSDKEventType::StateChange);
                 {
+                    std::lock_guard<std::mutex> lock(m_stateMutex);
+
+                    if (m_heartbeatRequest.m_currentGameState == state)
+                    {
+                        return;
+                    }
+                    stateChange.m_previousState = GameStateNames[static_cast<int>(m_heartbeatRequest.m_currentGameState)];
+                    stateChange.m_newState = GameStateNames[static_cast<int>(state)];
                     m_heartbeatRequest.m_currentGameState = state;
                     m_signalHeartbeatEvent.Signal();
                 }
+
+                // Outside the lock, so subscribers can read the state
+                m_eventBus.publish(stateChange);
             }
 
             void GSDKInternal::setConnectedPlayers(const std::vector<ConnectedPlayer>& currentConnectedPlayers)
@@ -279,11 +444,19 @@ namespace Microsoft
 
             void GSDKInternal::runShutdownCallback()
             {
-                std::function<void()> temp = get().m_shutdownCallback;
+                auto temp = get().m_shutdownCallback.get();
+                recordMilestone(LifecycleMilestone::ShutdownCallbackStarted);
+
+                // Before the game's callback, which often exits the process, so inline subscribers get to finish their work
+                get().m_eventBus.publish(GSDKEvent(GSDKEventType::Shutdown));
                 if (temp != nullptr)
                 {
-                    temp();
+                    (*temp)();
                 }
+                recordMilestone(LifecycleMilestone::ShutdownCallbackEnded);
+
+                // Games are often stopped soon after their shutdown callback, so this may be the last chance to write the timeline
+                get().writeLifecycleTimeline();
                 get().m_keepHeartbeatRunning = false;
             }
 
@@ -299,26 +472,84 @@ namespace Microsoft
                     GSDK::logMessage("Failed to parse heartbeat");
                     GSDK::logMessage(jsonParseErrors);
                     GSDK::logMessage("Message: " + responseJson);
+                    publishHeartbeatFailure(0, "Failed to parse heartbeat: " + jsonParseErrors);
+                    return;
+                }
+
+                processHeartbeatResponse(heartbeatResponse);
+            }
+
+            void GSDKInternal::decodeHeartbeatResponse(const std::string& responseBody, const char* contentType)
+            {
+                if (!cMessagePack::isContentType(contentType))
+                {
+                    if (m_heartbeatEncoding == HeartbeatEncoding::Negotiating)
+                    {
+                        m_heartbeatEncoding = HeartbeatEncoding::Json;
+                        if (m_debug) GSDK::logMessage("Agent answered in JSON, heartbeats stay in JSON.");
+                    }
+                    decodeHeartbeatResponse(responseBody);
                     return;
                 }
 
+                Json::Value heartbeatResponse;
+                std::string parseErrors;
+                if (!cMessagePack::decode(responseBody, heartbeatResponse, parseErrors))
+                {
+                    GSDK::logMessage("Failed to parse heartbeat");
+                    GSDK::logMessage(parseErrors);
+                    publishHeartbeatFailure(0, "Failed to parse heartbeat: " + parseErrors);
+                    return;
+                }
+
+                if (m_heartbeatEncoding != HeartbeatEncoding::MessagePack)
+                {
+                    m_heartbeatEncoding = HeartbeatEncoding::MessagePack;
+                    GSDK::logMessage("Agent answered in MessagePack, heartbeats switch to MessagePack.");
+                }
+                processHeartbeatResponse(heartbeatResponse);
+            }
+
+            void GSDKInternal::processHeartbeatResponse(const Json::Value& heartbeatResponse)
+            {
                 try {
-                    if (heartbeatResponse.isMember("sessionConfig"))
+                    GSDKEvent configChange(GSDKEventType::ConfigChange);
+                    auto setConfig = [this, &configChange](const Json::ValueConstIterator &member, const Json::Value &value)
+                    {
+                        const char *keyEnd;
+                        const char *keyBegin = member.memberName(&keyEnd);
+                        const char *valueEnd;
+                        const char *valueBegin;
+                        value.getString(&valueBegin, &valueEnd);
+
+                        std::string key(keyBegin, keyEnd);
+                        if (setConfigSetting(key, valueBegin, valueEnd - valueBegin))
+                        {
+                            configChange.m_changedConfigKeys.push_back(key);
+                        }
+                    };
+
+                    // The agent repeats the session config in every heartbeat, so it is only applied when its hash changes
+                    const Json::Value &sessionConfig = heartbeatResponse["sessionConfig"];
+                    unsigned long long sessionConfigHash = heartbeatResponse.isMember("sessionConfig") ? hashJson(sessionConfig, c_fnvOffsetBasis) : 0;
+                    if (heartbeatResponse.isMember("sessionConfig") && (!m_hasSessionConfigHash || sessionConfigHash != m_sessionConfigHash))
                     {
 						std::lock_guard<std::mutex> lock(m_configMutex);
-						Json::Value sessionConfig = heartbeatResponse["sessionConfig"];
-                        for (Json::ValueIterator i = sessionConfig.begin(); i != sessionConfig.end(); ++i)
+                        m_sessionConfigHash = sessionConfigHash;
+                        m_hasSessionConfigHash = true;
+
+                        for (Json::ValueConstIterator i = sessionConfig.begin(); i != sessionConfig.end(); ++i)
                         {
                             if ((*i).isString())
                             {
-								m_configSettings[i.key().asCString()] = (*i).asCString();
+								setConfig(i, *i);
                             }
                         }
 
                         // Update initial players only if this is the first time populating it.
                         if (m_initialPlayers.empty() && sessionConfig.isMember("initialPlayers"))
                         {
-                            Json::Value players = sessionConfig["initialPlayers"];
+                            const Json::Value &players = sessionConfig["initialPlayers"];
 
                             for (Json::ArrayIndex i = 0; i < players.size(); ++i)
                             {
@@ -328,15 +559,26 @@ namespace Microsoft
 
                         if (sessionConfig.isMember("metadata"))
                         {
-                            Json::Value sessionMetadata = sessionConfig["metadata"];
-                            for (Json::ValueIterator i = sessionMetadata.begin(); i != sessionMetadata.end(); ++i)
+                            const Json::Value &sessionMetadata = sessionConfig["metadata"];
+                            for (Json::ValueConstIterator i = sessionMetadata.begin(); i != sessionMetadata.end(); ++i)
                             {
                                 if ((*i).isString())
                                 {
-									m_configSettings[i.key().asCString()] = (*i).asCString();
+									setConfig(i, *i);
                                 }
                             }
                         }
+
+                        if (!configChange.m_changedConfigKeys.empty())
+                        {
+                            configChange.m_configVersion = ++m_configVersion;
+                        }
+                    }
+
+                    // Outside the lock, so subscribers can read the config
+                    if (!configChange.m_changedConfigKeys.empty())
+                    {
+                        m_eventBus.publish(configChange);
                     }
 
                     if (heartbeatResponse.isMember("nextScheduledMaintenanceUtc"))
@@ -345,12 +587,18 @@ namespace Microsoft
                         time_t nextMaintenanceTime = cGSDKUtils::tm2timet_utc(&nextMaintenance);
                         time_t cachedMaintenanceTime = cGSDKUtils::tm2timet_utc(&m_cachedScheduledMaintenance);
                         double diff = difftime(nextMaintenanceTime, cachedMaintenanceTime);
-                        auto temp = m_maintenanceCallback;
+                        auto temp = m_maintenanceCallback.get();
 
                         // If the cached time converted to -1, it means we haven't cached anything yet
-                        if (temp != nullptr && (static_cast<int>(diff) != 0 || cachedMaintenanceTime == -1))
+                        if ((temp != nullptr || m_eventBus.hasSubscribers(GSDKEventType::Maintenance)) && (static_cast<int>(diff) != 0 || cachedMaintenanceTime == -1))
                         {
-                            temp(nextMaintenance);
+                            if (temp != nullptr)
+                            {
+                                (*temp)(nextMaintenance);
+                            }
+                            GSDKEvent maintenance(GSDKEventType::Maintenance);
+                            maintenance.m_maintenanceTime = nextMaintenance;
+                            m_eventBus.publish(maintenance);
                             m_cachedScheduledMaintenance = nextMaintenance; // cache it so we only notify once
                         }
                     }
@@ -374,13 +622,45 @@ namespace Microsoft
                             case Operation::Active:
                                 if (m_heartbeatRequest.m_currentGameState != GameState::Active)
                                 {
+                                    recordMilestone(LifecycleMilestone::ActiveReceived);
                                     setState(GameState::Active);
+
+                                    // The allocation is the root of a trace, which the PlayFab calls made for it join
+                                    TraceSpan allocationSpan;
+                                    allocationSpan.m_name = "gsdk.allocation";
+                                    allocationSpan.m_context = TraceContext::newTrace();
+                                    allocationSpan.m_startTime = std::chrono::system_clock::now();
+                                    {
+                                        std::lock_guard<std::mutex> lock(m_configMutex);
+                                        m_allocationTraceContext = allocationSpan.m_context;
+                                        allocationSpan.m_stringAttributes["gsdk.session_id"] = configValue(ConfigKey::SessionId);
+                                    }
+                                    allocationSpan.m_numberAttributes["gsdk.initial_player_count"] = static_cast<double>(m_initialPlayers.size());
+
+                                    // Let subscribers start allocation work (e.g. fetching player data) before the game thread wakes up
+                                    {
+                                        ScopedTraceContext scopedTraceContext(allocationSpan.m_context);
+                                        auto allocationCallback = m_allocationCallback.get();
+                                        if (allocationCallback != nullptr)
+                                        {
+                                            (*allocationCallback)(m_initialPlayers);
+                                        }
+
+                                        GSDKEvent allocation(GSDKEventType::Allocation);
+                                        allocation.m_initialPlayers = m_initialPlayers;
+                                        m_eventBus.publish(allocation);
+                                    }
+
                                     m_transitionToActiveEvent.Signal();
+
+                                    allocationSpan.m_endTime = std::chrono::system_clock::now();
+                                    GSDKTrace::exportSpan(allocationSpan);
                                 }
                                 break;
                             case Operation::Terminate:
                                 if (m_heartbeatRequest.m_currentGameState != GameState::Terminating)
                                 {
+                                    recordMilestone(LifecycleMilestone::TerminateReceived);
                                     setState(GameState::Terminating);
                                     m_transitionToActiveEvent.Signal();
                                     m_shutdownThread = std::async(std::launch::async, &runShutdownCallback);
@@ -416,49 +696,227 @@ namespace Microsoft
                     // we caught an exception - log it out
                     GSDK::logMessage("An error occured while processing heartbeat.");
                     GSDK::logMessage(ex.what());
-                    GSDK::logMessage("Message: " + responseJson);
+                    GSDK::logMessage("Message: " + heartbeatResponse.toStyledString());
                 }
             }
 
             void GSDKInternal::receiveHeartbeatResponse()
             {
                 long http_code = 0;
+                char *contentType = nullptr;
                 curl_easy_getinfo(m_curlHandle, CURLINFO_RESPONSE_CODE, &http_code);
+                curl_easy_getinfo(m_curlHandle, CURLINFO_CONTENT_TYPE, &contentType);
+
+                // An agent that can't read a MessagePack request gets JSON from now on, starting with an early heartbeat
+                if (m_heartbeatEncoding == HeartbeatEncoding::MessagePack && (http_code == 400 || http_code == 415))
+                {
+                    GSDK::logMessage("Agent rejected a MessagePack heartbeat with status code " + std::to_string(http_code) + ", falling back to JSON.");
+                    m_heartbeatEncoding = HeartbeatEncoding::Json;
+                    m_signalHeartbeatEvent.Signal();
+                    return;
+                }
+
                 if (http_code >= 300)
                 {
                     GSDK::logMessage("Received non-success code from Agent.  Status Code: " + std::to_string(http_code) + " Response Body: " + m_receivedData);
+                    publishHeartbeatFailure(http_code, m_receivedData);
                     return;
                 }
 
-                decodeHeartbeatResponse(m_receivedData);
+                // No status means the agent wasn't reached, unless a held heartbeat was abandoned for shutdown
+                if (http_code == 0)
+                {
+                    if (m_keepHeartbeatRunning)
+                    {
+                        GSDK::logMessage("Could not reach the Agent.");
+                        publishHeartbeatFailure(0, "The agent could not be reached.");
+                    }
+                    return;
+                }
+
+                if (http_code >= 200)
+                {
+                    recordMilestone(LifecycleMilestone::FirstSuccessfulHeartbeat);
+                }
+
+                decodeHeartbeatResponse(m_receivedData, contentType);
+            }
+
+            unsigned long long GSDKInternal::hashJson(const Json::Value& value, unsigned long long hash)
+            {
+                // FNV-1a over the type and contents of each value. Members are visited in key order, so equal objects hash equally.
+                auto mix = [&hash](const void *data, size_t size)
+                {
+                    const unsigned char *bytes = static_cast<const unsigned char*>(data);
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        hash = (hash ^ bytes[i]) * c_fnvPrime;
+                    }
+                };
+
+                const unsigned char type = static_cast<unsigned char>(value.type());
+                mix(&type, sizeof(type));
+
+                switch (value.type())
+                {
+                case Json::nullValue:
+                    break;
+                case Json::booleanValue:
+                {
+                    const unsigned char flag = value.asBool() ? 1 : 0;
+                    mix(&flag, sizeof(flag));
+                    break;
+                }
+                case Json::intValue:
+                {
+                    const Json::Int64 number = value.asInt64();
+                    mix(&number, sizeof(number));
+                    break;
+                }
+                case Json::uintValue:
+                {
+                    const Json::UInt64 number = value.asUInt64();
+                    mix(&number, sizeof(number));
+                    break;
+                }
+                case Json::realValue:
+                {
+                    const double number = value.asDouble();
+                    mix(&number, sizeof(number));
+                    break;
+                }
+                case Json::stringValue:
+                {
+                    const char *end;
+                    const char *begin;
+                    value.getString(&begin, &end);
+                    const size_t length = end - begin;
+                    mix(&length, sizeof(length)); // So "ab","c" and "a","bc" differ
+                    mix(begin, length);
+                    break;
+                }
+                case Json::arrayValue:
+                    for (Json::ArrayIndex i = 0; i < value.size(); ++i)
+                    {
+                        hash = hashJson(value[i], hash);
+                    }
+                    break;
+                case Json::objectValue:
+                    for (Json::ValueConstIterator i = value.begin(); i != value.end(); ++i)
+                    {
+                        const char *keyEnd;
+                        const char *keyBegin = i.memberName(&keyEnd);
+                        const size_t length = keyEnd - keyBegin;
+                        mix(&length, sizeof(length));
+                        mix(keyBegin, length);
+                        hash = hashJson(*i, hash);
+                    }
+                    break;
+                }
+
+                // Closes containers, so moving a value out of one changes the hash
+                mix(&type, sizeof(type));
+                return hash;
+            }
+
+            bool GSDKInternal::setConfigSetting(const std::string& key, const char* value, size_t length)
+            {
+                std::string &current = m_configSettings[key];
+                if (current.compare(0, std::string::npos, value, length) == 0)
+                {
+                    return false;
+                }
+                current.assign(value, length);
+
+                int index = findConfigKey(key);
+                if (index >= 0)
+                {
+                    m_configValues[index] = current;
+                }
+                return true;
+            }
+
+            void GSDKInternal::buildGamePortIndex(const std::unordered_map<std::string, std::string>& listeningPorts)
+            {
+                m_gamePortIndex = m_connectionInfo.m_gamePortsConfiguration;
+
+                // Configurations without the connection info only give each port's listening port, as a string setting
+                for (auto it = listeningPorts.begin(); it != listeningPorts.end(); ++it)
+                {
+                    bool indexed = std::any_of(m_gamePortIndex.begin(), m_gamePortIndex.end(), [&it](const GamePort& port) { return port.m_name == it->first; });
+                    if (!indexed)
+                    {
+                        m_gamePortIndex.emplace_back(it->first, atoi(it->second.c_str()), 0);
+                    }
+                }
+
+                std::sort(m_gamePortIndex.begin(), m_gamePortIndex.end(), [](const GamePort& a, const GamePort& b) { return a.m_name < b.m_name; });
+            }
+
+            int GSDKInternal::findConfigKey(const std::string& key)
+            {
+                for (int i = 0; i < static_cast<int>(ConfigKey::Count); ++i)
+                {
+                    if (key == ConfigKeyNames[i])
+                    {
+                        return i;
+                    }
+                }
+                return -1;
+            }
+
+            void GSDKInternal::publishHeartbeatFailure(long httpCode, const std::string& message)
+            {
+                GSDKEvent failure(GSDKEventType::HeartbeatFailure);
+                failure.m_httpStatusCode = httpCode;
+                failure.m_failureMessage = message;
+                m_eventBus.publish(failure);
             }
 
             Microsoft::Azure::Gaming::GSDKInternal& GSDKInternal::get()
             {
+                // Once started, this is a single acquire load
+                GSDKInternal* instance = m_instancePtr.load(std::memory_order_acquire);
+                if (instance != nullptr)
+                {
+                    return *instance;
+                }
+
+                // Only the first calls get here. A constructor that throws leaves both pointers null, so the next call tries again.
                 std::unique_lock<std::mutex> lock(m_gsdkInitMutex);
 
                 if (!m_instance)
                 {
                     m_instance = std::make_unique<GSDKInternal>();
                 }
+                m_instancePtr.store(m_instance.get(), std::memory_order_release);
                 return *m_instance;
             }
 
             void GSDK::start(bool debugLogs)
             {
+                GSDKInternal::recordMilestone(LifecycleMilestone::StartEntered);
                 GSDKInternal::m_debug = debugLogs;
                 GSDKInternal::get();
+                GSDKInternal::recordMilestone(LifecycleMilestone::StartReturned);
+            }
+
+            bool GSDK::isStarted()
+            {
+                return GSDKInternal::m_instancePtr.load(std::memory_order_acquire) != nullptr;
             }
 
             bool GSDK::readyForPlayers()
             {
-                if (GSDKInternal::get().m_heartbeatRequest.m_currentGameState != GameState::Active)
+                GSDKInternal& gsdk = GSDKInternal::get();
+                if (gsdk.m_heartbeatRequest.m_currentGameState != GameState::Active)
                 {
-                    GSDKInternal::get().setState(GameState::StandingBy);
-                    GSDKInternal::get().m_transitionToActiveEvent.Wait();
+                    gsdk.setState(GameState::StandingBy);
+                    gsdk.m_transitionToActiveEvent.Wait();
                 }
 
-                return GSDKInternal::get().m_heartbeatRequest.m_currentGameState == GameState::Active;
+                GSDKInternal::recordMilestone(LifecycleMilestone::ReadyForPlayersReturned);
+                return gsdk.m_heartbeatRequest.m_currentGameState == GameState::Active;
             }
 
             const Microsoft::Azure::Gaming::GameServerConnectionInfo &GSDK::getGameServerConnectionInfo()
@@ -466,30 +924,68 @@ namespace Microsoft
                 return GSDKInternal::get().m_connectionInfo;
             }
 
+            const GamePort* GSDK::getGamePort(const std::string& name)
+            {
+                const std::vector<GamePort>& index = GSDKInternal::get().m_gamePortIndex;
+                auto port = std::lower_bound(index.begin(), index.end(), name, [](const GamePort& candidate, const std::string& name) { return candidate.m_name < name; });
+                return (port != index.end() && port->m_name == name) ? &*port : nullptr;
+            }
+
             const std::unordered_map<std::string, std::string> GSDK::getConfigSettings()
             {
 				std::lock_guard<std::mutex> lock(GSDKInternal::get().m_configMutex);
                 return GSDKInternal::get().m_configSettings;
             }
 
+            unsigned long long GSDK::getConfigVersion()
+            {
+                return GSDKInternal::get().m_configVersion;
+            }
+
             void GSDK::updateConnectedPlayers(const std::vector<ConnectedPlayer>& currentlyConnectedPlayers)
             {
+                GSDKInternal::recordMilestone(LifecycleMilestone::FirstConnectedPlayersUpdate);
                 GSDKInternal::get().setConnectedPlayers(currentlyConnectedPlayers);
             }
 
             void GSDK::registerShutdownCallback(std::function< void() > callback)
             {
-                GSDKInternal::get().m_shutdownCallback = callback;
+                GSDKInternal::get().m_shutdownCallback.set(callback);
             }
 
             void GSDK::registerHealthCallback(std::function< bool() > callback)
             {
-                GSDKInternal::get().m_healthCallback = callback;
+                GSDKInternal::get().m_healthCallback.set(callback);
             }
 
             void GSDK::registerMaintenanceCallback(std::function< void(const tm&) > callback)
             {
-                GSDKInternal::get().m_maintenanceCallback = callback;
+                GSDKInternal::get().m_maintenanceCallback.set(callback);
+            }
+
+            void GSDK::registerAllocationCallback(std::function< void(const std::vector<std::string>&) > callback)
+            {
+                GSDKInternal::get().m_allocationCallback.set(callback);
+            }
+
+            GSDKSubscriptionId GSDK::subscribe(GSDKEventType type, std::function< void(const GSDKEvent&) > callback, GSDKEventExecutor executor)
+            {
+                return GSDKInternal::get().m_eventBus.subscribe(type, callback, executor);
+            }
+
+            void GSDK::unsubscribe(GSDKSubscriptionId id)
+            {
+                // A GSDK that has shut down took its subscriptions with it, and mustn't be started again just to drop one
+                GSDKInternal* instance = GSDKInternal::m_instancePtr.load(std::memory_order_acquire);
+                if (instance != nullptr)
+                {
+                    instance->m_eventBus.unsubscribe(id);
+                }
+            }
+
+            size_t GSDK::dispatchQueuedEvents()
+            {
+                return GSDKInternal::get().m_eventBus.dispatchQueuedEvents();
             }
 
             unsigned int GSDK::logMessage(const std::string& message)
@@ -502,48 +998,54 @@ namespace Microsoft
 
             const std::string GSDK::getLogsDirectory()
             {
-                // Declare as static so that it doesn't live on the stack (since we're returning a reference)
-                static const std::string empty = "";
-
-				std::lock_guard<std::mutex> lock(GSDKInternal::get().m_configMutex);
-
-                const std::unordered_map<std::string, std::string> config = GSDKInternal::get().m_configSettings;
-                auto it = config.find(GSDK::LOG_FOLDER_KEY);
-
-                if (it == config.end())
-                {
-                    return empty;
-                }
-                else
-                {
-					return it->second;
-                }
+                return getConfigValue(ConfigKey::LogFolder);
             }
 
             const std::string GSDK::getSharedContentDirectory()
             {
-                // Declare as static so that it doesn't live on the stack (since we're returning a reference)
-                static const std::string empty = "";
-
-				std::lock_guard<std::mutex> lock(GSDKInternal::get().m_configMutex);
+                return getConfigValue(ConfigKey::SharedContentFolder);
+            }
 
-				const std::unordered_map<std::string, std::string> config = GSDKInternal::get().m_configSettings;
+            const std::string GSDK::getConfigValue(ConfigKey key)
+            {
+                GSDKInternal& gsdk = GSDKInternal::get();
+                std::lock_guard<std::mutex> lock(gsdk.m_configMutex);
+                return gsdk.configValue(key);
+            }
 
-                auto it = config.find(GSDK::SHARED_CONTENT_FOLDER_KEY);
+            const std::vector<std::string>& GSDK::getInitialPlayers()
+            {
+                return GSDKInternal::get().m_initialPlayers;
+            }
 
-                if (it == config.end())
+            std::vector<LifecycleEvent> GSDK::getLifecycleTimeline()
+            {
+                std::vector<LifecycleEvent> timeline;
+                for (int i = 0; i < static_cast<int>(LifecycleMilestone::Count); ++i)
                 {
-                    return empty;
+                    long long ticks = GSDKInternal::m_milestoneTimes[i];
+                    if (ticks != 0)
+                    {
+                        LifecycleEvent event;
+                        event.m_milestone = static_cast<LifecycleMilestone>(i);
+                        event.m_name = LifecycleMilestoneNames[i];
+                        event.m_time = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(ticks));
+                        timeline.push_back(event);
+                    }
                 }
-                else
+
+                std::sort(timeline.begin(), timeline.end(), [](const LifecycleEvent &a, const LifecycleEvent &b) { return a.m_time < b.m_time; });
+                for (LifecycleEvent &event : timeline)
                 {
-                    return it->second;
+                    event.m_elapsedMs = std::chrono::duration<double, std::milli>(event.m_time - timeline.front().m_time).count();
                 }
+                return timeline;
             }
 
-            const std::vector<std::string>& GSDK::getInitialPlayers()
+            const TraceContext GSDK::getAllocationTraceContext()
             {
-                return GSDKInternal::get().m_initialPlayers;
+                std::lock_guard<std::mutex> lock(GSDKInternal::get().m_configMutex);
+                return GSDKInternal::get().m_allocationTraceContext;
             }
         }
     }
@@ -9,6 +9,10 @@
 #include <exception>
 #include <vector>
 #include <stdexcept>
+#include <chrono>
+
+#include "gsdkTrace.h"
+#include "gsdkEvents.h"
 
 namespace Microsoft
 {
@@ -50,13 +54,19 @@ namespace Microsoft
                     /// </summary>
                     int m_clientConnectionPort;
 
+                    /// <summary>
+                    /// "TCP" or "UDP", as specified in the Build configuration. Empty when the configuration doesn't say.
+                    /// </summary>
+                    std::string m_protocol;
+
                     GamePort() {}
 
-                    GamePort(std::string name, int serverListeningPort, int clientConnectionPort)
+                    GamePort(std::string name, int serverListeningPort, int clientConnectionPort, std::string protocol = std::string())
                     {
                         m_name = name;
                         m_serverListeningPort = serverListeningPort;
                         m_clientConnectionPort = clientConnectionPort;
+                        m_protocol = protocol;
                     }
             };
 
@@ -75,6 +85,59 @@ namespace Microsoft
                     }
             };
 
+            /// <summary>
+            /// The well-known configuration settings, which GSDK::getConfigValue reads without a map lookup.
+            /// Each is also in getConfigSettings, under the matching GSDK::*_KEY name.
+            /// </summary>
+            enum class ConfigKey
+            {
+                HeartbeatEndpoint,
+                ServerId,
+                LogFolder,
+                SharedContentFolder,
+                CertificateFolder,
+                TitleId,
+                BuildId,
+                Region,
+                VmId,
+                PublicIpV4Address,
+                FullyQualifiedDomainName,
+                SessionCookie, // After allocation
+                SessionId,     // After allocation
+                Count
+            };
+
+            /// <summary>
+            /// The points in a game server's life that the GSDK records the time of.
+            /// </summary>
+            enum class LifecycleMilestone
+            {
+                StartEntered,
+                StartReturned,
+                FirstSuccessfulHeartbeat,
+                StandingBySent,
+                ActiveReceived,
+                ReadyForPlayersReturned,
+                FirstConnectedPlayersUpdate,
+                TerminateReceived,
+                ShutdownCallbackStarted,
+                ShutdownCallbackEnded,
+                Count
+            };
+
+            class LifecycleEvent
+            {
+            public:
+                LifecycleMilestone m_milestone;
+                std::string m_name;
+
+                /// <summary>When the milestone was first reached, on the monotonic clock.</summary>
+                std::chrono::steady_clock::time_point m_time;
+
+                /// <summary>Milliseconds since the first milestone reached, which is normally StartEntered.</summary>
+                double m_elapsedMs;
+            };
+
             class GSDKInitializationException : public std::runtime_error
             {
                 using std::runtime_error::runtime_error;
@@ -95,14 +158,31 @@ namespace Microsoft
                 /// <returns></returns>
                 static const GameServerConnectionInfo &getGameServerConnectionInfo();
 
+                /// <summary>Returns the game port with the given name, or null if the Build configuration has none by that name.</summary>
+                /// <remarks>Looked up in an index built at start, without locking or copying, so it is cheap enough for connection paths.
+                /// The port stays valid for the life of the GSDK. Its m_clientConnectionPort is 0 when the configuration only gives the listening port.</remarks>
+                static const GamePort *getGamePort(const std::string &name);
+
                 /// <summary>Returns all configuration settings</summary>
                 /// <returns>unordered map of string key:value configuration setting values</returns>
                 static const std::unordered_map<std::string, std::string> getConfigSettings();
 
+                /// <summary>Returns one well-known configuration setting, empty when it isn't set.</summary>
+                /// <remarks>Cheaper than getConfigSettings, which copies every setting.</remarks>
+                static const std::string getConfigValue(ConfigKey key);
+
+                /// <summary>Returns a number that grows each time the agent changes a configuration setting, so games can tell the settings changed without copying them.</summary>
+                /// <remarks>To be told which settings changed, subscribe to GSDKEventType::ConfigChange.</remarks>
+                static unsigned long long getConfigVersion();
+
                 /// <summary>Kicks off communication threads, heartbeats, etc.  Called implicitly by ReadyForPlayers if not called beforehand.</summary>
                 /// <param name="debugLogs">Enables outputting additional logs to the GSDK log file.</param>
                 static void start(bool debugLogs = false);
 
+                /// <summary>Returns whether the GSDK has been started (explicitly or by any other GSDK call) and not shut down since.</summary>
+                /// <remarks>Unlike every other call here, this never starts the GSDK, so helpers can check before they subscribe.</remarks>
+                static bool isStarted();
+
                 /// <summary>Tells the Xcloud service information on who is connected.</summary>
                 /// <param name="currentlyConnectedPlayers"></param>
                 static void updateConnectedPlayers(const std::vector<ConnectedPlayer> &currentlyConnectedPlayers);
@@ -116,6 +196,23 @@ namespace Microsoft
                 /// <summary>Gets called if the server is getting a scheduled maintenance, it will get the UTC time of the maintenance event as an argument.</summary>
                 static void registerMaintenanceCallback(std::function<void(const tm &)> callback);
 
+                /// <summary>Gets called when the server is allocated, before readyForPlayers returns, with the list of initial players.</summary>
+                /// <remarks>Runs on the heartbeat thread, so it should only kick off work (e.g. async requests) and return quickly.</remarks>
+                static void registerAllocationCallback(std::function<void(const std::vector<std::string> &)> callback);
+
+                /// <summary>Subscribes to an event type. Any number of subscribers can share a type, alongside the register*Callback callbacks.</summary>
+                /// <param name="executor">Where the handler runs. Worker and GameQueue handlers never hold up heartbeats, Inline handlers run on the heartbeat thread for most events and must return quickly.</param>
+                /// <returns>The id to pass to unsubscribe.</returns>
+                static GSDKSubscriptionId subscribe(GSDKEventType type, std::function<void(const GSDKEvent &)> handler, GSDKEventExecutor executor = GSDKEventExecutor::Worker);
+
+                /// <summary>Stops delivering events to a subscriber. Events already handed to the worker or the game queue are still delivered.</summary>
+                /// <remarks>Does nothing (and doesn't start the GSDK) when the GSDK isn't running.</remarks>
+                static void unsubscribe(GSDKSubscriptionId id);
+
+                /// <summary>Runs the GameQueue handlers of the events raised so far on the calling thread. Call it from the game loop.</summary>
+                /// <returns>How many handlers ran.</returns>
+                static size_t dispatchQueuedEvents();
+
                 /// <summary>outputs a message to the log</summary>
                 static unsigned int logMessage(const std::string &message);
 
@@ -128,6 +225,15 @@ namespace Microsoft
                 /// <summary>After allocation, returns a list of the initial players that have access to this game server, used by PlayFab's Matchmaking offering</summary>
                 static const std::vector<std::string> &getInitialPlayers();
 
+                /// <summary>After allocation, returns the trace context of the allocation, invalid before that.</summary>
+                /// <remarks>PlayFab calls made inside a ScopedTraceContext of it (e.g. AuthenticateSessionTicket for the connecting players) join the allocation's trace.
+                /// The calls the allocation callback makes join it without that.</remarks>
+                static const TraceContext getAllocationTraceContext();
+
+                /// <summary>Returns the lifecycle milestones reached so far, in the order they were reached.</summary>
+                /// <remarks>The timeline is also written to the log folder (GSDK_timeline_*.json) once the shutdown callback returns, and again when the GSDK shuts down.</remarks>
+                static std::vector<LifecycleEvent> getLifecycleTimeline();
+
                 // Keys for the map returned by getConfigSettings
 
                 static constexpr const char* HEARTBEAT_ENDPOINT_KEY = "gsmsBaseUrl";
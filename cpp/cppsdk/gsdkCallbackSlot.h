@@ -0,0 +1,42 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <functional>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            /// <summary>
+            /// Holds a callback that one thread may register while others invoke it.
+            /// Each registration swaps in a new immutable holder, so invokers never copy the std::function or its captures,
+            /// and the holder an invoker loaded stays alive until that invocation returns, even if it was replaced meanwhile.
+            /// </summary>
+            template <typename Signature>
+            class CallbackSlot
+            {
+            public:
+                typedef std::shared_ptr<const std::function<Signature>> Holder;
+
+                void set(std::function<Signature> callback)
+                {
+                    Holder holder = callback != nullptr ? std::make_shared<const std::function<Signature>>(std::move(callback)) : nullptr;
+                    std::atomic_store(&m_holder, holder);
+                }
+
+                /// <summary>Returns the registered callback, or null. Invoke it through the returned holder: (*holder)(args).</summary>
+                Holder get() const
+                {
+                    return std::atomic_load(&m_holder);
+                }
+
+            private:
+                Holder m_holder; // Only accessed through std::atomic_load/atomic_store
+            };
+        }
+    }
+}
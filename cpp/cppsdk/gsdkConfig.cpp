@@ -2,7 +2,490 @@
 #include "gsdkConfig.h"
 #include "gsdk.h"
 #include "gsdkUtils.h"
-#include "fstream"
+
+namespace
+{
+    using Microsoft::Azure::Gaming::GSDKInitializationException;
+
+    constexpr int c_maxSkipDepth = 64; // The settings nest three levels, so anything this deep is malformed
+
+    // A key as it appears in the file, or in the reader's scratch buffer when it had escapes
+    struct JsonText
+    {
+        const char *m_begin;
+        size_t m_length;
+
+        bool operator==(const char *name) const
+        {
+            return strlen(name) == m_length && memcmp(m_begin, name, m_length) == 0;
+        }
+    };
+
+    // Decodes the config file in one pass, checking each setting against the type the GSDK expects as it goes.
+    // Strings without escapes are copied once, straight from the file into their setting, and keys not at all.
+    class ConfigJsonReader
+    {
+    public:
+        ConfigJsonReader(const char *json, size_t length) : m_begin(json), m_position(json), m_end(json + length)
+        {
+            // Editors on Windows may save the file with a UTF-8 byte order mark
+            if (length >= 3 && memcmp(json, "\xEF\xBB\xBF", 3) == 0)
+            {
+                m_begin += 3;
+                m_position += 3;
+            }
+        }
+
+        // Calls onMember with each key, with the reader at the member's value, which onMember has to read or skip
+        template <typename OnMember>
+        void readObject(const char *name, OnMember onMember)
+        {
+            skipWhitespace();
+            if (!consume('{'))
+            {
+                fail(std::string("expected an object for ") + name);
+            }
+
+            skipWhitespace();
+            if (consume('}'))
+            {
+                return;
+            }
+
+            while (true)
+            {
+                skipWhitespace();
+                if (peek() != '"')
+                {
+                    fail("expected a quoted key");
+                }
+                JsonText key = readKey();
+
+                skipWhitespace();
+                if (!consume(':'))
+                {
+                    fail("expected ':' after a key");
+                }
+                skipWhitespace();
+                onMember(key);
+
+                skipWhitespace();
+                if (consume('}'))
+                {
+                    return;
+                }
+                if (!consume(','))
+                {
+                    fail("expected ',' or '}'");
+                }
+            }
+        }
+
+        // Calls onElement with the reader at each element, which onElement has to read or skip
+        template <typename OnElement>
+        void readArray(const char *name, OnElement onElement)
+        {
+            skipWhitespace();
+            if (!consume('['))
+            {
+                fail(std::string("expected an array for ") + name);
+            }
+
+            skipWhitespace();
+            if (consume(']'))
+            {
+                return;
+            }
+
+            while (true)
+            {
+                skipWhitespace();
+                onElement();
+
+                skipWhitespace();
+                if (consume(']'))
+                {
+                    return;
+                }
+                if (!consume(','))
+                {
+                    fail("expected ',' or ']'");
+                }
+            }
+        }
+
+        // A null reads as an empty string, as the settings are optional
+        void readString(std::string &value, const char *name)
+        {
+            skipWhitespace();
+            if (consumeLiteral("null"))
+            {
+                value.clear();
+                return;
+            }
+            if (peek() != '"')
+            {
+                fail(std::string("expected a string for ") + name);
+            }
+
+            const char *begin = ++m_position;
+            scanPlainCharacters();
+            value.assign(begin, m_position);
+            finishString(value);
+        }
+
+        void readStringMap(std::unordered_map<std::string, std::string> &values, const char *name)
+        {
+            readObject(name, [this, &values, name](const JsonText &key)
+            {
+                readString(values[std::string(key.m_begin, key.m_length)], name);
+            });
+        }
+
+        // A null reads as port 0, as the settings are optional
+        int readPort(const char *name)
+        {
+            skipWhitespace();
+            if (consumeLiteral("null"))
+            {
+                return 0;
+            }
+
+            const char *begin = m_position;
+            int port = 0;
+            while (m_position < m_end && *m_position >= '0' && *m_position <= '9' && port <= 65535)
+            {
+                port = port * 10 + (*m_position - '0');
+                ++m_position;
+            }
+
+            char next = peek();
+            if (m_position == begin || port > 65535 || next == '.' || next == 'e' || next == 'E' || (next >= '0' && next <= '9'))
+            {
+                fail(std::string("expected a port number between 0 and 65535 for ") + name, begin);
+            }
+            return port;
+        }
+
+        // Checks the syntax of a value whose setting the GSDK doesn't use, without keeping any of it
+        void skipValue(int depth = 0)
+        {
+            skipWhitespace();
+            if (depth > c_maxSkipDepth)
+            {
+                fail("values are nested too deeply");
+            }
+
+            switch (peek())
+            {
+            case '{':
+                readObject("the value", [this, depth](const JsonText &) { skipValue(depth + 1); });
+                break;
+            case '[':
+                readArray("the value", [this, depth]() { skipValue(depth + 1); });
+                break;
+            case '"':
+                readString(m_scratch, "the value");
+                break;
+            case 't':
+            case 'f':
+            case 'n':
+                if (!consumeLiteral("true") && !consumeLiteral("false") && !consumeLiteral("null"))
+                {
+                    fail("expected a value");
+                }
+                break;
+            default:
+                skipNumber();
+                break;
+            }
+        }
+
+        void expectEnd()
+        {
+            skipWhitespace();
+            if (m_position != m_end)
+            {
+                fail("unexpected text after the configuration");
+            }
+        }
+
+    private:
+        const char *m_begin;
+        const char *m_position;
+        const char *m_end;
+        std::string m_scratch; // Keys with escapes, and skipped strings
+
+        char peek() const
+        {
+            return m_position < m_end ? *m_position : '\0';
+        }
+
+        bool consume(char expected)
+        {
+            if (peek() != expected)
+            {
+                return false;
+            }
+            ++m_position;
+            return true;
+        }
+
+        bool consumeLiteral(const char *literal)
+        {
+            size_t length = strlen(literal);
+            if (static_cast<size_t>(m_end - m_position) < length || memcmp(m_position, literal, length) != 0)
+            {
+                return false;
+            }
+            m_position += length;
+            return true;
+        }
+
+        // Comments are allowed, as they were when the file was read into a json tree
+        void skipWhitespace()
+        {
+            while (m_position < m_end)
+            {
+                char c = *m_position;
+                if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+                {
+                    ++m_position;
+                }
+                else if (c == '/' && m_position + 1 < m_end && m_position[1] == '/')
+                {
+                    while (m_position < m_end && *m_position != '\n')
+                    {
+                        ++m_position;
+                    }
+                }
+                else if (c == '/' && m_position + 1 < m_end && m_position[1] == '*')
+                {
+                    const char *begin = m_position;
+                    m_position += 2;
+                    while (m_position + 1 < m_end && !(m_position[0] == '*' && m_position[1] == '/'))
+                    {
+                        ++m_position;
+                    }
+                    if (m_position + 1 >= m_end)
+                    {
+                        fail("unterminated comment", begin);
+                    }
+                    m_position += 2;
+                }
+                else
+                {
+                    return;
+                }
+            }
+        }
+
+        void scanPlainCharacters()
+        {
+            while (m_position < m_end && *m_position != '"' && *m_position != '\\' && static_cast<unsigned char>(*m_position) >= 0x20)
+            {
+                ++m_position;
+            }
+        }
+
+        JsonText readKey()
+        {
+            const char *begin = ++m_position;
+            scanPlainCharacters();
+            if (peek() == '"')
+            {
+                JsonText key = { begin, static_cast<size_t>(m_position - begin) };
+                ++m_position;
+                return key;
+            }
+
+            m_scratch.assign(begin, m_position);
+            finishString(m_scratch);
+            JsonText key = { m_scratch.data(), m_scratch.size() };
+            return key;
+        }
+
+        // Appends the rest of a string that scanPlainCharacters stopped in, decoding its escapes
+        void finishString(std::string &value)
+        {
+            while (true)
+            {
+                if (m_position >= m_end)
+                {
+                    fail("unterminated string");
+                }
+
+                char c = *m_position;
+                if (c == '"')
+                {
+                    ++m_position;
+                    return;
+                }
+                if (c != '\\')
+                {
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        fail("control characters in strings must be escaped");
+                    }
+                    const char *begin = m_position;
+                    scanPlainCharacters();
+                    value.append(begin, m_position);
+                    continue;
+                }
+
+                const char *escape = m_position++;
+                switch (peek())
+                {
+                case '"': value.push_back('"'); break;
+                case '\\': value.push_back('\\'); break;
+                case '/': value.push_back('/'); break;
+                case 'b': value.push_back('\b'); break;
+                case 'f': value.push_back('\f'); break;
+                case 'n': value.push_back('\n'); break;
+                case 'r': value.push_back('\r'); break;
+                case 't': value.push_back('\t'); break;
+                case 'u':
+                {
+                    ++m_position;
+                    unsigned int codePoint = readHex4(escape);
+                    if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+                    {
+                        fail("unpaired surrogate in \\u escape", escape);
+                    }
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        if (!consumeLiteral("\\u"))
+                        {
+                            fail("unpaired surrogate in \\u escape", escape);
+                        }
+                        unsigned int low = readHex4(escape);
+                        if (low < 0xDC00 || low > 0xDFFF)
+                        {
+                            fail("unpaired surrogate in \\u escape", escape);
+                        }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(value, codePoint);
+                    continue;
+                }
+                default:
+                    fail("invalid escape in string", escape);
+                }
+                ++m_position;
+            }
+        }
+
+        unsigned int readHex4(const char *escape)
+        {
+            unsigned int value = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                char c = peek();
+                unsigned int digit;
+                if (c >= '0' && c <= '9') { digit = c - '0'; }
+                else if (c >= 'a' && c <= 'f') { digit = c - 'a' + 10; }
+                else if (c >= 'A' && c <= 'F') { digit = c - 'A' + 10; }
+                else { fail("\\u escapes need four hex digits", escape); }
+                value = (value << 4) | digit;
+                ++m_position;
+            }
+            return value;
+        }
+
+        static void appendUtf8(std::string &value, unsigned int codePoint)
+        {
+            if (codePoint < 0x80)
+            {
+                value.push_back(static_cast<char>(codePoint));
+            }
+            else if (codePoint < 0x800)
+            {
+                value.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000)
+            {
+                value.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else
+            {
+                value.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                value.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+
+        void skipDigits()
+        {
+            while (m_position < m_end && *m_position >= '0' && *m_position <= '9')
+            {
+                ++m_position;
+            }
+        }
+
+        void skipNumber()
+        {
+            const char *begin = m_position;
+            consume('-');
+
+            const char *digits = m_position;
+            skipDigits();
+            if (m_position == digits)
+            {
+                fail("expected a value", begin);
+            }
+
+            if (consume('.'))
+            {
+                digits = m_position;
+                skipDigits();
+                if (m_position == digits)
+                {
+                    fail("expected digits after the decimal point", begin);
+                }
+            }
+
+            if (consume('e') || consume('E'))
+            {
+                if (!consume('+'))
+                {
+                    consume('-');
+                }
+                digits = m_position;
+                skipDigits();
+                if (m_position == digits)
+                {
+                    fail("expected digits in the exponent", begin);
+                }
+            }
+        }
+
+        [[noreturn]] void fail(const std::string &message)
+        {
+            fail(message, m_position);
+        }
+
+        // Lines and columns are only worked out here, so reading well formed files never tracks them
+        [[noreturn]] void fail(const std::string &message, const char *at)
+        {
+            int line = 1;
+            const char *lineBegin = m_begin;
+            for (const char *c = m_begin; c < at; ++c)
+            {
+                if (*c == '\n')
+                {
+                    ++line;
+                    lineBegin = c + 1;
+                }
+            }
+
+            throw GSDKInitializationException("Failed to parse configuration at line " + std::to_string(line) + ", column " + std::to_string(at - lineBegin + 1) + ": " + message);
+        }
+    };
+}
 
 Microsoft::Azure::Gaming::ConfigurationBase::ConfigurationBase()
 {
@@ -105,93 +588,119 @@ const Microsoft::Azure::Gaming::GameServerConnectionInfo &Microsoft::Azure::Gami
 
 Microsoft::Azure::Gaming::JsonFileConfiguration::JsonFileConfiguration(const std::string &file_name) : Microsoft::Azure::Gaming::ConfigurationBase::ConfigurationBase()
 {
-    std::ifstream is(file_name, std::ifstream::in);
+    cMappedFile file(file_name);
 
-    if (!is.fail())
+    if (!file.isOpen())
     {
-        Json::CharReaderBuilder jsonReaderFactory;
-        Json::Value configFile;
+        throw GSDKInitializationException("Failed to open configuration file: " + file_name);
+    }
 
-        JSONCPP_STRING jsonParseErrors;
-        bool parsedSuccessfully = Json::parseFromStream(jsonReaderFactory, is, &configFile, &jsonParseErrors);
+    parse(file.data(), file.size());
+}
 
-        if (parsedSuccessfully)
-        {
-            m_heartbeatEndpoint = configFile["heartbeatEndpoint"].asString();
-            m_serverId = configFile["sessionHostId"].asString();
-            m_logFolder = configFile["logFolder"].asString();
-            m_sharedContentFolder = configFile["sharedContentFolder"].asString();
+Microsoft::Azure::Gaming::JsonFileConfiguration::JsonFileConfiguration(const char *json, size_t length) : Microsoft::Azure::Gaming::ConfigurationBase::ConfigurationBase()
+{
+    parse(json, length);
+}
 
-            if (configFile.isMember("certificateFolder"))
-            {
-                m_certFolder = configFile["certificateFolder"].asString();
-            }
-            else
-            {
-                m_certFolder = std::string();
-            }
+void Microsoft::Azure::Gaming::JsonFileConfiguration::parse(const char *json, size_t length)
+{
+    // No logging setup at this point, so the reader throws
+    ConfigJsonReader reader(json, length);
 
-            if (configFile.isMember("gameCertificates"))
+    const std::pair<const char*, std::string JsonFileConfiguration::*> stringSettings[] =
+    {
+        { "heartbeatEndpoint", &JsonFileConfiguration::m_heartbeatEndpoint },
+        { "sessionHostId", &JsonFileConfiguration::m_serverId },
+        { "logFolder", &JsonFileConfiguration::m_logFolder },
+        { "sharedContentFolder", &JsonFileConfiguration::m_sharedContentFolder },
+        { "certificateFolder", &JsonFileConfiguration::m_certFolder },
+        { "publicIpV4Address", &JsonFileConfiguration::m_ipv4Address },
+        { "fullyQualifiedDomainName", &JsonFileConfiguration::m_domainName },
+    };
+
+    reader.readObject("the configuration", [&](const JsonText &key)
+    {
+        for (const auto &setting : stringSettings)
+        {
+            if (key == setting.first)
             {
-                Json::Value gameCerts = configFile["gameCertificates"];
-                for (Json::ValueIterator i = gameCerts.begin(); i != gameCerts.end(); ++i)
-                {
-                    m_gameCerts[i.key().asCString()] = (*i).asCString();
-                }
+                reader.readString(this->*setting.second, setting.first);
+                return;
             }
+        }
 
-            if (configFile.isMember("buildMetadata"))
+        if (key == "gameCertificates")
+        {
+            reader.readStringMap(m_gameCerts, "gameCertificates");
+        }
+        else if (key == "buildMetadata")
+        {
+            reader.readStringMap(m_metadata, "buildMetadata");
+        }
+        else if (key == "gamePorts")
+        {
+            reader.readStringMap(m_ports, "gamePorts");
+        }
+        else if (key == "gameServerConnectionInfo")
+        {
+            std::string publicIpV4Address;
+            std::vector<GamePort> gamePorts;
+
+            reader.readObject("gameServerConnectionInfo", [&](const JsonText &connectionInfoKey)
             {
-                Json::Value metadata = configFile["buildMetadata"];
-                for (Json::ValueIterator i = metadata.begin(); i != metadata.end(); ++i)
+                if (connectionInfoKey == "publicIpV4Adress") // publicIpV4Adress is a typo that exists in the gsdkConfig file...
                 {
-                    m_metadata[i.key().asCString()] = (*i).asCString();
+                    reader.readString(publicIpV4Address, "publicIpV4Adress");
                 }
-            }
-
-            if (configFile.isMember("gamePorts"))
-            {
-                Json::Value ports = configFile["gamePorts"];
-                for (Json::ValueIterator i = ports.begin(); i != ports.end(); ++i)
+                else if (connectionInfoKey == "gamePortsConfiguration")
                 {
-                    m_ports[i.key().asCString()] = (*i).asCString();
+                    reader.readArray("gamePortsConfiguration", [&]()
+                    {
+                        gamePorts.emplace_back(std::string(), 0, 0);
+                        GamePort &port = gamePorts.back();
+
+                        reader.readObject("a gamePortsConfiguration entry", [&](const JsonText &portKey)
+                        {
+                            if (portKey == "name")
+                            {
+                                reader.readString(port.m_name, "name");
+                            }
+                            else if (portKey == "serverListeningPort")
+                            {
+                                port.m_serverListeningPort = reader.readPort("serverListeningPort");
+                            }
+                            else if (portKey == "clientConnectionPort")
+                            {
+                                port.m_clientConnectionPort = reader.readPort("clientConnectionPort");
+                            }
+                            else if (portKey == "protocol")
+                            {
+                                reader.readString(port.m_protocol, "protocol");
+                            }
+                            else
+                            {
+                                reader.skipValue();
+                            }
+                        });
+                    });
                 }
-            }
-
-            if (configFile.isMember("publicIpV4Address"))
-            {
-                m_ipv4Address = configFile["publicIpV4Address"].asString();
-            }
-
-            if (configFile.isMember("fullyQualifiedDomainName"))
-            {
-                m_domainName = configFile["fullyQualifiedDomainName"].asString();
-            }
-
-            if (configFile.isMember("gameServerConnectionInfo"))
-            {
-                Json::Value connectionInfo = configFile["gameServerConnectionInfo"];
-                Json::Value portsConfiguration = connectionInfo["gamePortsConfiguration"];
-                std::vector<GamePort> gamePorts;
-
-                for (Json::ValueIterator port = portsConfiguration.begin(); port != portsConfiguration.end(); ++port)
+                else
                 {
-                    gamePorts.emplace_back((*port)["name"].asString(), (*port)["serverListeningPort"].asInt(), (*port)["clientConnectionPort"].asInt());
+                    reader.skipValue();
                 }
+            });
 
-                m_connectionInfo = GameServerConnectionInfo(connectionInfo["publicIpV4Adress"].asString(), gamePorts); // publicIpV4Adress is a typo that exists in the gsdkConfig file...
-            }
+            m_connectionInfo = GameServerConnectionInfo(publicIpV4Address, gamePorts);
         }
         else
         {
-            // No logging setup at this point, so throw an exception
-            throw GSDKInitializationException("Failed to parse configuration: " + jsonParseErrors);
+            // Settings added to the file after this version of the GSDK
+            reader.skipValue();
         }
-    }
-    else
-    {
-        throw GSDKInitializationException("Failed to open configuration file: " + file_name);
-    }
+    });
+
+    reader.expectEnd();
 }
 
 const std::string &Microsoft::Azure::Gaming::JsonFileConfiguration::getHeartbeatEndpoint()
@@ -91,7 +91,10 @@ namespace Microsoft
             class JsonFileConfiguration : public ConfigurationBase
             {
             public:
+                // Maps the file and decodes it in a single pass straight into the settings below, without building a json tree.
+                // Throws a GSDKInitializationException, with the line and column for malformed or mistyped settings.
                 JsonFileConfiguration(const std::string &file_name);
+                JsonFileConfiguration(const char *json, size_t length);
 
                 const std::string &getHeartbeatEndpoint();
                 const std::string &getServerId();
@@ -117,6 +120,8 @@ namespace Microsoft
                 std::string m_ipv4Address;
                 std::string m_domainName;
                 GameServerConnectionInfo m_connectionInfo;
+
+                void parse(const char *json, size_t length);
             };
         }
     }
@@ -0,0 +1,185 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkEventBus.h"
+#include "gsdk.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            namespace
+            {
+                // A throwing handler must not take down the thread that raised the event, which is usually the heartbeat thread
+                void runHandler(const std::function<void(const GSDKEvent &)> &handler, const GSDKEvent &event)
+                {
+                    try
+                    {
+                        handler(event);
+                    }
+                    catch (const std::exception &ex)
+                    {
+                        GSDK::logMessage(std::string("GSDK event subscriber threw: ") + ex.what());
+                    }
+                }
+            }
+
+            GSDKEventBus::GSDKEventBus() : m_nextSubscriptionId(1), m_workerRunning(false)
+            {
+            }
+
+            GSDKEventBus::~GSDKEventBus()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_workerMutex);
+                    m_workerRunning = false;
+                }
+                m_workerCondition.notify_all();
+                if (m_workerThread.joinable())
+                {
+                    m_workerThread.join();
+                }
+            }
+
+            GSDKSubscriptionId GSDKEventBus::subscribe(GSDKEventType type, std::function<void(const GSDKEvent &)> handler, GSDKEventExecutor executor)
+            {
+                std::lock_guard<std::mutex> lock(m_subscribeMutex);
+
+                std::shared_ptr<const SubscriberList> current = std::atomic_load(&m_subscribers[static_cast<int>(type)]);
+                std::shared_ptr<SubscriberList> updated = current != nullptr ? std::make_shared<SubscriberList>(*current) : std::make_shared<SubscriberList>();
+                Subscriber subscriber;
+                subscriber.m_id = m_nextSubscriptionId++;
+                subscriber.m_executor = executor;
+                subscriber.m_handler = std::make_shared<const std::function<void(const GSDKEvent &)>>(std::move(handler));
+                updated->push_back(subscriber);
+
+                std::atomic_store(&m_subscribers[static_cast<int>(type)], std::shared_ptr<const SubscriberList>(updated));
+                return subscriber.m_id;
+            }
+
+            void GSDKEventBus::unsubscribe(GSDKSubscriptionId id)
+            {
+                std::lock_guard<std::mutex> lock(m_subscribeMutex);
+
+                for (auto &subscribers : m_subscribers)
+                {
+                    std::shared_ptr<const SubscriberList> current = std::atomic_load(&subscribers);
+                    if (current == nullptr)
+                    {
+                        continue;
+                    }
+
+                    auto found = std::find_if(current->begin(), current->end(), [id](const Subscriber &subscriber) { return subscriber.m_id == id; });
+                    if (found != current->end())
+                    {
+                        std::shared_ptr<SubscriberList> updated = std::make_shared<SubscriberList>(*current);
+                        updated->erase(updated->begin() + (found - current->begin()));
+                        std::atomic_store(&subscribers, std::shared_ptr<const SubscriberList>(updated));
+                        return;
+                    }
+                }
+            }
+
+            void GSDKEventBus::publish(const GSDKEvent &event)
+            {
+                std::shared_ptr<const SubscriberList> subscribers = std::atomic_load(&m_subscribers[static_cast<int>(event.m_type)]);
+                if (subscribers == nullptr || subscribers->empty())
+                {
+                    return;
+                }
+
+                // Copied once for all the handlers that run later, which also carry the trace context it was raised in
+                std::shared_ptr<const GSDKEvent> sharedEvent;
+                TraceContext traceContext = GSDKTrace::getCurrentContext();
+
+                for (const Subscriber &subscriber : *subscribers)
+                {
+                    if (subscriber.m_executor == GSDKEventExecutor::Inline)
+                    {
+                        runHandler(*subscriber.m_handler, event);
+                        continue;
+                    }
+
+                    if (sharedEvent == nullptr)
+                    {
+                        sharedEvent = std::make_shared<const GSDKEvent>(event);
+                    }
+                    std::shared_ptr<const std::function<void(const GSDKEvent &)>> handler = subscriber.m_handler;
+                    std::function<void()> work = [handler, sharedEvent, traceContext]()
+                    {
+                        ScopedTraceContext scopedTraceContext(traceContext);
+                        runHandler(*handler, *sharedEvent);
+                    };
+
+                    if (subscriber.m_executor == GSDKEventExecutor::Worker)
+                    {
+                        runOnWorker(work);
+                    }
+                    else
+                    {
+                        std::lock_guard<std::mutex> lock(m_gameQueueMutex);
+                        m_gameQueue.push_back(work);
+                    }
+                }
+            }
+
+            bool GSDKEventBus::hasSubscribers(GSDKEventType type)
+            {
+                std::shared_ptr<const SubscriberList> subscribers = std::atomic_load(&m_subscribers[static_cast<int>(type)]);
+                return subscribers != nullptr && !subscribers->empty();
+            }
+
+            size_t GSDKEventBus::dispatchQueuedEvents()
+            {
+                std::deque<std::function<void()>> queued;
+                {
+                    std::lock_guard<std::mutex> lock(m_gameQueueMutex);
+                    queued.swap(m_gameQueue);
+                }
+
+                // Events raised by these handlers wait for the next call, so a handler that raises events can't keep this from returning
+                for (const auto &work : queued)
+                {
+                    work();
+                }
+                return queued.size();
+            }
+
+            void GSDKEventBus::runOnWorker(std::function<void()> work)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_workerMutex);
+                    m_workerQueue.push_back(work);
+                    if (!m_workerRunning && !m_workerThread.joinable())
+                    {
+                        m_workerRunning = true;
+                        m_workerThread = std::thread(&GSDKEventBus::workerThreadFunc, this);
+                    }
+                }
+                m_workerCondition.notify_one();
+            }
+
+            void GSDKEventBus::workerThreadFunc()
+            {
+                std::unique_lock<std::mutex> lock(m_workerMutex);
+                while (true)
+                {
+                    m_workerCondition.wait(lock, [this]() { return !m_workerRunning || !m_workerQueue.empty(); });
+                    if (!m_workerRunning)
+                    {
+                        return;
+                    }
+
+                    std::function<void()> work = m_workerQueue.front();
+                    m_workerQueue.pop_front();
+
+                    lock.unlock();
+                    work();
+                    lock.lock();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <deque>
+#include <condition_variable>
+#include "gsdkEvents.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            /// <summary>
+            /// Delivers each GSDK event to every subscriber of its type, on the executor each subscriber chose.
+            /// Publishing takes no lock: the subscribers of a type are an immutable list, which subscribe and unsubscribe replace whole.
+            /// </summary>
+            class GSDKEventBus
+            {
+            public:
+                GSDKEventBus();
+                ~GSDKEventBus();
+
+                GSDKSubscriptionId subscribe(GSDKEventType type, std::function<void(const GSDKEvent &)> handler, GSDKEventExecutor executor);
+
+                // Handlers already handed to the worker or the game queue still run
+                void unsubscribe(GSDKSubscriptionId id);
+
+                void publish(const GSDKEvent &event);
+                bool hasSubscribers(GSDKEventType type);
+                size_t dispatchQueuedEvents();
+
+            private:
+                class Subscriber
+                {
+                public:
+                    GSDKSubscriptionId m_id;
+                    GSDKEventExecutor m_executor;
+                    std::shared_ptr<const std::function<void(const GSDKEvent &)>> m_handler; // Shared by the queued work, so publishing never copies the captures
+                };
+                typedef std::vector<Subscriber> SubscriberList;
+
+                void runOnWorker(std::function<void()> work);
+                void workerThreadFunc();
+
+                std::shared_ptr<const SubscriberList> m_subscribers[static_cast<int>(GSDKEventType::Count)]; // Only accessed through std::atomic_load/atomic_store
+                std::mutex m_subscribeMutex; // Serializes the replacements
+                GSDKSubscriptionId m_nextSubscriptionId;
+
+                std::mutex m_workerMutex;
+                std::condition_variable m_workerCondition;
+                std::deque<std::function<void()>> m_workerQueue;
+                std::thread m_workerThread; // Started by the first Worker handler
+                bool m_workerRunning;
+
+                std::mutex m_gameQueueMutex;
+                std::deque<std::function<void()>> m_gameQueue;
+            };
+        }
+    }
+}
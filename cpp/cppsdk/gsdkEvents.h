@@ -0,0 +1,59 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ctime>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            enum class GSDKEventType
+            {
+                Shutdown,         // The agent asked the server to shut down
+                Maintenance,      // A maintenance event was scheduled, see m_maintenanceTime
+                StateChange,      // The state sent to the agent changed, see m_previousState and m_newState
+                ConfigChange,     // Session config or metadata values changed, see m_changedConfigKeys
+                Allocation,       // The server was allocated, see m_initialPlayers
+                HeartbeatFailure, // A heartbeat failed, see m_httpStatusCode and m_failureMessage
+                Count
+            };
+
+            /// <summary>
+            /// Where a subscriber's handler runs.
+            /// </summary>
+            enum class GSDKEventExecutor
+            {
+                Inline,   // On the thread that raised the event, usually the heartbeat thread, so the handler must return quickly
+                Worker,   // On the GSDK's event worker thread, in the order the events were raised
+                GameQueue // On the game's thread, when it calls GSDK::dispatchQueuedEvents
+            };
+
+            typedef unsigned long long GSDKSubscriptionId;
+
+            /// <summary>
+            /// An event raised by the GSDK. Only the members that belong to its type are set.
+            /// </summary>
+            class GSDKEvent
+            {
+            public:
+                GSDKEventType m_type;
+
+                std::string m_previousState;                   // StateChange
+                std::string m_newState;                        // StateChange
+                tm m_maintenanceTime = {};                     // Maintenance, in UTC
+                std::vector<std::string> m_changedConfigKeys;  // ConfigChange
+                unsigned long long m_configVersion = 0;        // ConfigChange, what GSDK::getConfigVersion returns from then on
+                std::vector<std::string> m_initialPlayers;     // Allocation
+                long m_httpStatusCode = 0;                     // HeartbeatFailure, 0 when the agent could not be reached
+                std::string m_failureMessage;                  // HeartbeatFailure
+
+                explicit GSDKEvent(GSDKEventType type) : m_type(type) {}
+            };
+        }
+    }
+}
@@ -8,6 +8,9 @@
 #include "gsdkUtils.h"
 #include "ManualResetEvent.h"
 #include "gsdkConfig.h"
+#include "gsdkMessagePack.h"
+#include "gsdkEventBus.h"
+#include "gsdkCallbackSlot.h"
 
 namespace Microsoft
 {
@@ -37,6 +40,25 @@ namespace Microsoft
                 GAME_STATES(MAKE_STRINGS)
             };
 
+            // The getConfigSettings name of each ConfigKey, in enum order
+            constexpr const char* ConfigKeyNames[] =
+            {
+                GSDK::HEARTBEAT_ENDPOINT_KEY,
+                GSDK::SERVER_ID_KEY,
+                GSDK::LOG_FOLDER_KEY,
+                GSDK::SHARED_CONTENT_FOLDER_KEY,
+                GSDK::CERTIFICATE_FOLDER_KEY,
+                GSDK::TITLE_ID_KEY,
+                GSDK::BUILD_ID_KEY,
+                GSDK::REGION_KEY,
+                GSDK::VM_ID_KEY,
+                GSDK::PUBLIC_IP_V4_ADDRESS_KEY,
+                GSDK::FULLY_QUALIFIED_DOMAIN_NAME_KEY,
+                GSDK::SESSION_COOKIE_KEY,
+                GSDK::SESSION_ID_KEY,
+            };
+            static_assert(sizeof(ConfigKeyNames) / sizeof(ConfigKeyNames[0]) == static_cast<size_t>(ConfigKey::Count), "Every ConfigKey needs a name");
+
             #define GAME_OPERATIONS(DO) \
                 DO( Invalid ) \
                 DO( Continue ) \
@@ -57,6 +79,28 @@ namespace Microsoft
             };
 
 
+            const char* const LifecycleMilestoneNames[] =
+            {
+                "StartEntered",
+                "StartReturned",
+                "FirstSuccessfulHeartbeat",
+                "StandingBySent",
+                "ActiveReceived",
+                "ReadyForPlayersReturned",
+                "FirstConnectedPlayersUpdate",
+                "TerminateReceived",
+                "ShutdownCallbackStarted",
+                "ShutdownCallbackEnded"
+            };
+            static_assert(sizeof(LifecycleMilestoneNames) / sizeof(LifecycleMilestoneNames[0]) == static_cast<size_t>(LifecycleMilestone::Count), "Every lifecycle milestone needs a name");
+
+            enum class HeartbeatEncoding
+            {
+                Json,        // The agent did not take up MessagePack, so it is no longer offered
+                Negotiating, // JSON requests, whose Accept header offers MessagePack responses
+                MessagePack  // The agent answered in MessagePack, so requests are sent in it too
+            };
+
             class SessionConfig
             {
             public:
@@ -144,12 +188,15 @@ namespace Microsoft
                 int m_heatbeatInterval;
                 std::string m_heartbeatUrl;
 
-                std::function<void()> m_shutdownCallback;
-                std::function<bool()> m_healthCallback;
-                std::function<void(const tm &)> m_maintenanceCallback;
+                CallbackSlot<void()> m_shutdownCallback;
+                CallbackSlot<bool()> m_healthCallback;
+                CallbackSlot<void(const tm &)> m_maintenanceCallback;
+                CallbackSlot<void(const std::vector<std::string> &)> m_allocationCallback;
 
                 GameServerConnectionInfo m_connectionInfo;
+                std::vector<GamePort> m_gamePortIndex; // Sorted by name for getGamePort. Built in the constructor and never changed after, so read without locking
                 std::unordered_map<std::string, std::string> m_configSettings;
+                std::string m_configValues[static_cast<int>(ConfigKey::Count)]; // The well-known settings, also in m_configSettings. Both are guarded by m_configMutex
                 tm m_cachedScheduledMaintenance;
 
                 std::atomic<bool> m_keepHeartbeatRunning;
@@ -167,36 +214,57 @@ namespace Microsoft
 
                 CURL *m_curlHandle; // only valid for heartbeat thread
                 curl_slist *m_curlHttpHeaders; // only valid for heartbeat thread
+                curl_slist *m_curlNegotiatingHttpHeaders; // only valid for heartbeat thread
+                curl_slist *m_curlMessagePackHttpHeaders; // only valid for heartbeat thread
+                HeartbeatEncoding m_heartbeatEncoding; // only valid for heartbeat thread
+                int m_longPollWaitSeconds; // How long the agent may hold a StandingBy heartbeat, 0 when long polls are off
+                curl_slist *m_curlLongPollHttpHeader; // "Prefer: wait=N", linked in front of the other headers for long polls. Only valid for heartbeat thread
+                bool m_isLongPolling; // The heartbeat in flight asks to be held. Only valid for heartbeat thread
+                bool m_longPollApplied; // The agent agreed to hold the heartbeat in flight. Only valid for heartbeat thread
                 std::mutex m_receivedDataMutex;
                 std::string m_receivedData;
                 ManualResetEvent m_transitionToActiveEvent;
-                ManualResetEvent m_signalHeartbeatEvent;
+                AutoResetEvent m_signalHeartbeatEvent;
                 std::mutex m_stateMutex;
                 std::mutex m_playersMutex;
 
                 std::vector<std::string> m_initialPlayers;
+                TraceContext m_allocationTraceContext; // Guarded by m_configMutex, like the session config it belongs to
 
-                static std::unique_ptr<GSDKInternal> m_instance;
+                static std::unique_ptr<GSDKInternal> m_instance; // Owns the instance. Only changed under m_gsdkInitMutex
+                static std::atomic<GSDKInternal*> m_instancePtr; // What get() returns without locking, null until the instance is fully constructed
                 static std::mutex m_gsdkInitMutex;
 
                 static volatile long long m_exitStatus;
+
+                // Static, so the timeline starts before the instance exists. steady_clock ticks, 0 until the milestone is reached.
+                static std::atomic<long long> m_milestoneTimes[static_cast<int>(LifecycleMilestone::Count)];
+                std::string m_timelinePath; // Empty when not logging
+                std::mutex m_timelineMutex;
                 static std::mutex m_logLock;
                 static std::ofstream m_logFile;
 
                 void heartbeatThreadFunc();
                 static size_t curlReceiveData(char *buffer, size_t blockSize, size_t blockCount, void *);
+                static size_t curlReceiveHeader(char *buffer, size_t blockSize, size_t blockCount, void *userData);
+                static int curlLongPollProgress(void *userData, curl_off_t, curl_off_t, curl_off_t, curl_off_t);
                 static void runShutdownCallback();
                 
                 static bool m_debug;
 
                 void startLog();
+                static void recordMilestone(LifecycleMilestone milestone);
+                void writeLifecycleTimeline();
                 void resetCurl();
                 void sendHeartbeat();
                 void receiveHeartbeatResponse();
 
-                // These two methods are used for unit testing as well as regular operation.
+                // These methods are used for unit testing as well as regular operation.
+                Json::Value buildHeartbeatRequest();
                 std::string encodeHeartbeatRequest();
                 void decodeHeartbeatResponse(const std::string &responseJson);
+                void decodeHeartbeatResponse(const std::string &responseBody, const char *contentType);
+                void processHeartbeatResponse(const Json::Value &heartbeatResponse);
 				std::mutex m_configMutex;
                 int m_nextHeartbeatIntervalMs;
 
@@ -206,6 +274,25 @@ namespace Microsoft
 
                 static GSDKInternal &get();
                 static std::unique_ptr<Configuration> testConfiguration; // may be overriden by unit tests
+
+                void publishHeartbeatFailure(long httpCode, const std::string &message);
+
+                // Sets a setting in both m_configSettings and, when it is a well-known one, m_configValues. Returns false if it already had that value.
+                bool setConfigSetting(const std::string &key, const char *value, size_t length);
+                bool setConfigSetting(const std::string &key, const std::string &value) { return setConfigSetting(key, value.data(), value.size()); }
+                static int findConfigKey(const std::string &key); // -1 for the keys that aren't well-known
+                void buildGamePortIndex(const std::unordered_map<std::string, std::string> &listeningPorts);
+                const std::string &configValue(ConfigKey key) const { return m_configValues[static_cast<int>(key)]; }
+
+                static constexpr unsigned long long c_fnvOffsetBasis = 14695981039346656037ULL;
+                static constexpr unsigned long long c_fnvPrime = 1099511628211ULL;
+                static unsigned long long hashJson(const Json::Value &value, unsigned long long hash);
+                unsigned long long m_sessionConfigHash; // Of the last session config applied. Only valid for heartbeat thread
+                bool m_hasSessionConfigHash; // Only valid for heartbeat thread
+                std::atomic<unsigned long long> m_configVersion; // Bumped by every session config that changes a value
+
+                // Last, so its worker thread stops before the rest of the instance goes away
+                GSDKEventBus m_eventBus;
             };
 
         }
@@ -0,0 +1,329 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkMessagePack.h"
+
+#include <cstdint>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            namespace
+            {
+                constexpr int c_maxDecodeDepth = 64; // Heartbeats nest a few levels, so anything deeper is malformed
+
+                void appendBigEndian(std::string &out, uint64_t value, int byteCount)
+                {
+                    for (int shift = (byteCount - 1) * 8; shift >= 0; shift -= 8)
+                    {
+                        out.push_back(static_cast<char>((value >> shift) & 0xff));
+                    }
+                }
+
+                // Writes the smallest header of the family: the fix form when the length fits in its low bits, then 8, 16 and 32 bit lengths.
+                // Arrays and maps have no 8 bit form, so their marker8 is 0.
+                void appendHeader(std::string &out, size_t length, uint8_t fixMarker, size_t fixLimit, uint8_t marker8, uint8_t marker16, uint8_t marker32)
+                {
+                    if (length <= fixLimit)
+                    {
+                        out.push_back(static_cast<char>(fixMarker | length));
+                    }
+                    else if (marker8 != 0 && length <= 0xff)
+                    {
+                        out.push_back(static_cast<char>(marker8));
+                        appendBigEndian(out, length, 1);
+                    }
+                    else if (length <= 0xffff)
+                    {
+                        out.push_back(static_cast<char>(marker16));
+                        appendBigEndian(out, length, 2);
+                    }
+                    else
+                    {
+                        out.push_back(static_cast<char>(marker32));
+                        appendBigEndian(out, length, 4);
+                    }
+                }
+
+                void appendString(std::string &out, const char *begin, const char *end)
+                {
+                    appendHeader(out, end - begin, 0xa0, 31, 0xd9, 0xda, 0xdb);
+                    out.append(begin, end);
+                }
+
+                void appendInt(std::string &out, int64_t value)
+                {
+                    if (value >= 0)
+                    {
+                        uint64_t unsignedValue = static_cast<uint64_t>(value);
+                        if (unsignedValue <= 0x7f) { out.push_back(static_cast<char>(unsignedValue)); }
+                        else if (unsignedValue <= 0xff) { out.push_back('\xcc'); appendBigEndian(out, unsignedValue, 1); }
+                        else if (unsignedValue <= 0xffff) { out.push_back('\xcd'); appendBigEndian(out, unsignedValue, 2); }
+                        else if (unsignedValue <= 0xffffffff) { out.push_back('\xce'); appendBigEndian(out, unsignedValue, 4); }
+                        else { out.push_back('\xcf'); appendBigEndian(out, unsignedValue, 8); }
+                    }
+                    else if (value >= -32) { out.push_back(static_cast<char>(value)); }
+                    else if (value >= INT8_MIN) { out.push_back('\xd0'); appendBigEndian(out, static_cast<uint64_t>(value), 1); }
+                    else if (value >= INT16_MIN) { out.push_back('\xd1'); appendBigEndian(out, static_cast<uint64_t>(value), 2); }
+                    else if (value >= INT32_MIN) { out.push_back('\xd2'); appendBigEndian(out, static_cast<uint64_t>(value), 4); }
+                    else { out.push_back('\xd3'); appendBigEndian(out, static_cast<uint64_t>(value), 8); }
+                }
+
+                void appendValue(std::string &out, const Json::Value &value)
+                {
+                    switch (value.type())
+                    {
+                    case Json::nullValue:
+                        out.push_back('\xc0');
+                        break;
+                    case Json::booleanValue:
+                        out.push_back(value.asBool() ? '\xc3' : '\xc2');
+                        break;
+                    case Json::intValue:
+                        appendInt(out, value.asInt64());
+                        break;
+                    case Json::uintValue:
+                        if (value.asUInt64() > static_cast<uint64_t>(INT64_MAX))
+                        {
+                            out.push_back('\xcf');
+                            appendBigEndian(out, value.asUInt64(), 8);
+                        }
+                        else
+                        {
+                            appendInt(out, value.asInt64());
+                        }
+                        break;
+                    case Json::realValue:
+                    {
+                        double real = value.asDouble();
+                        uint64_t bits;
+                        memcpy(&bits, &real, sizeof(bits));
+                        out.push_back('\xcb');
+                        appendBigEndian(out, bits, 8);
+                        break;
+                    }
+                    case Json::stringValue:
+                    {
+                        const char *begin;
+                        const char *end;
+                        value.getString(&begin, &end);
+                        appendString(out, begin, end);
+                        break;
+                    }
+                    case Json::arrayValue:
+                        appendHeader(out, value.size(), 0x90, 15, 0, 0xdc, 0xdd);
+                        for (Json::ArrayIndex i = 0; i < value.size(); ++i)
+                        {
+                            appendValue(out, value[i]);
+                        }
+                        break;
+                    case Json::objectValue:
+                        appendHeader(out, value.size(), 0x80, 15, 0, 0xde, 0xdf);
+                        for (Json::ValueConstIterator i = value.begin(); i != value.end(); ++i)
+                        {
+                            const char *keyEnd;
+                            const char *keyBegin = i.memberName(&keyEnd);
+                            appendString(out, keyBegin, keyEnd);
+                            appendValue(out, *i);
+                        }
+                        break;
+                    }
+                }
+
+                class Decoder
+                {
+                public:
+                    Decoder(const std::string &bytes) : m_next(bytes.data()), m_end(bytes.data() + bytes.size())
+                    {
+                    }
+
+                    bool decodeAll(Json::Value &value)
+                    {
+                        if (!decodeValue(value, 0))
+                        {
+                            return false;
+                        }
+                        if (m_next != m_end)
+                        {
+                            return fail("trailing bytes after the value");
+                        }
+                        return true;
+                    }
+
+                    std::string m_errors;
+
+                private:
+                    const char *m_next;
+                    const char *m_end;
+
+                    bool fail(const std::string &reason)
+                    {
+                        m_errors = "Invalid MessagePack: " + reason;
+                        return false;
+                    }
+
+                    bool readBigEndian(int byteCount, uint64_t &value)
+                    {
+                        if (m_end - m_next < byteCount)
+                        {
+                            return fail("truncated");
+                        }
+                        value = 0;
+                        for (int i = 0; i < byteCount; ++i)
+                        {
+                            value = (value << 8) | static_cast<uint8_t>(*m_next++);
+                        }
+                        return true;
+                    }
+
+                    bool readString(uint64_t length, Json::Value &value)
+                    {
+                        if (static_cast<uint64_t>(m_end - m_next) < length)
+                        {
+                            return fail("truncated");
+                        }
+                        value = Json::Value(m_next, m_next + length);
+                        m_next += length;
+                        return true;
+                    }
+
+                    bool readArray(uint64_t count, Json::Value &value, int depth)
+                    {
+                        // Every element takes at least a byte, which bounds the allocation for a bogus count
+                        if (static_cast<uint64_t>(m_end - m_next) < count)
+                        {
+                            return fail("truncated");
+                        }
+                        value = Json::Value(Json::arrayValue);
+                        for (uint64_t i = 0; i < count; ++i)
+                        {
+                            if (!decodeValue(value[static_cast<Json::ArrayIndex>(i)], depth + 1))
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    bool readMap(uint64_t count, Json::Value &value, int depth)
+                    {
+                        value = Json::Value(Json::objectValue);
+                        for (uint64_t i = 0; i < count; ++i)
+                        {
+                            Json::Value key;
+                            if (!decodeValue(key, depth + 1))
+                            {
+                                return false;
+                            }
+                            if (!key.isString())
+                            {
+                                return fail("map keys must be strings");
+                            }
+                            if (!decodeValue(value[key.asString()], depth + 1))
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    bool decodeValue(Json::Value &value, int depth)
+                    {
+                        if (depth > c_maxDecodeDepth)
+                        {
+                            return fail("nested too deeply");
+                        }
+                        if (m_next == m_end)
+                        {
+                            return fail("truncated");
+                        }
+
+                        const uint8_t marker = static_cast<uint8_t>(*m_next++);
+                        uint64_t bits;
+
+                        if (marker <= 0x7f) { value = Json::Value(static_cast<Json::UInt>(marker)); return true; }
+                        if (marker >= 0xe0) { value = Json::Value(static_cast<Json::Int>(static_cast<int8_t>(marker))); return true; }
+                        if ((marker & 0xe0) == 0xa0) { return readString(marker & 0x1f, value); }
+                        if ((marker & 0xf0) == 0x90) { return readArray(marker & 0x0f, value, depth); }
+                        if ((marker & 0xf0) == 0x80) { return readMap(marker & 0x0f, value, depth); }
+
+                        switch (marker)
+                        {
+                        case 0xc0: value = Json::Value(Json::nullValue); return true;
+                        case 0xc2: value = Json::Value(false); return true;
+                        case 0xc3: value = Json::Value(true); return true;
+                        case 0xc4: case 0xd9: return readBigEndian(1, bits) && readString(bits, value);
+                        case 0xc5: case 0xda: return readBigEndian(2, bits) && readString(bits, value);
+                        case 0xc6: case 0xdb: return readBigEndian(4, bits) && readString(bits, value);
+                        case 0xca:
+                        {
+                            if (!readBigEndian(4, bits)) return false;
+                            uint32_t bits32 = static_cast<uint32_t>(bits);
+                            float real;
+                            memcpy(&real, &bits32, sizeof(real));
+                            value = Json::Value(static_cast<double>(real));
+                            return true;
+                        }
+                        case 0xcb:
+                        {
+                            if (!readBigEndian(8, bits)) return false;
+                            double real;
+                            memcpy(&real, &bits, sizeof(real));
+                            value = Json::Value(real);
+                            return true;
+                        }
+                        case 0xcc: if (!readBigEndian(1, bits)) return false; value = Json::Value(static_cast<Json::UInt64>(bits)); return true;
+                        case 0xcd: if (!readBigEndian(2, bits)) return false; value = Json::Value(static_cast<Json::UInt64>(bits)); return true;
+                        case 0xce: if (!readBigEndian(4, bits)) return false; value = Json::Value(static_cast<Json::UInt64>(bits)); return true;
+                        case 0xcf: if (!readBigEndian(8, bits)) return false; value = Json::Value(static_cast<Json::UInt64>(bits)); return true;
+                        case 0xd0: if (!readBigEndian(1, bits)) return false; value = Json::Value(static_cast<Json::Int64>(static_cast<int8_t>(bits))); return true;
+                        case 0xd1: if (!readBigEndian(2, bits)) return false; value = Json::Value(static_cast<Json::Int64>(static_cast<int16_t>(bits))); return true;
+                        case 0xd2: if (!readBigEndian(4, bits)) return false; value = Json::Value(static_cast<Json::Int64>(static_cast<int32_t>(bits))); return true;
+                        case 0xd3: if (!readBigEndian(8, bits)) return false; value = Json::Value(static_cast<Json::Int64>(bits)); return true;
+                        case 0xdc: return readBigEndian(2, bits) && readArray(bits, value, depth);
+                        case 0xdd: return readBigEndian(4, bits) && readArray(bits, value, depth);
+                        case 0xde: return readBigEndian(2, bits) && readMap(bits, value, depth);
+                        case 0xdf: return readBigEndian(4, bits) && readMap(bits, value, depth);
+                        default:
+                            return fail("unsupported type " + std::to_string(marker));
+                        }
+                    }
+                };
+            }
+
+            std::string cMessagePack::encode(const Json::Value &value)
+            {
+                std::string out;
+                out.reserve(256);
+                appendValue(out, value);
+                return out;
+            }
+
+            bool cMessagePack::decode(const std::string &bytes, Json::Value &value, std::string &errors)
+            {
+                Decoder decoder(bytes);
+                if (!decoder.decodeAll(value))
+                {
+                    errors = decoder.m_errors;
+                    return false;
+                }
+                return true;
+            }
+
+            bool cMessagePack::isContentType(const char *contentType)
+            {
+                if (contentType == nullptr)
+                {
+                    return false;
+                }
+
+                std::string mediaType(contentType, strcspn(contentType, "; \t"));
+                std::transform(mediaType.begin(), mediaType.end(), mediaType.begin(), ::tolower);
+                return mediaType == "application/msgpack" || mediaType == "application/x-msgpack" || mediaType == "application/vnd.msgpack";
+            }
+        }
+    }
+}
@@ -0,0 +1,33 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include "json/json.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            /// <summary>
+            /// Converts between json values and MessagePack (https://msgpack.org), the compact binary encoding the heartbeat can negotiate with the agent.
+            /// </summary>
+            class cMessagePack
+            {
+            public:
+                static constexpr const char* CONTENT_TYPE = "application/msgpack";
+
+                static std::string encode(const Json::Value &value);
+
+                /// <summary>Decodes exactly one value spanning all of the bytes. Binary data decodes as a string.</summary>
+                /// <returns>False, with the reason in errors, for malformed input and for extension types.</returns>
+                static bool decode(const std::string &bytes, Json::Value &value, std::string &errors);
+
+                /// <summary>True for the MessagePack content types, ignoring parameters and case.</summary>
+                static bool isContentType(const char *contentType);
+            };
+        }
+    }
+}
@@ -0,0 +1,189 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkTrace.h"
+
+#include <random>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            std::shared_ptr<ITraceSink> GSDKTrace::m_sink;
+            std::mutex GSDKTrace::m_sinkMutex;
+            std::atomic<bool> GSDKTrace::m_exporting(false);
+
+            namespace
+            {
+                thread_local TraceContext currentContext;
+
+                // Ids only need to be unique, so each thread draws them from its own generator instead of sharing a locked one
+                std::string newRandomId(size_t hexLength)
+                {
+                    static const char hexDigits[] = "0123456789abcdef";
+                    thread_local std::mt19937_64 generator(std::random_device{}() ^ std::hash<std::thread::id>()(std::this_thread::get_id())
+                        ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+
+                    std::string id(hexLength, '0');
+                    uint64_t bits = 0;
+                    bool allZero = true;
+                    for (size_t i = 0; i < hexLength; ++i)
+                    {
+                        if (i % 16 == 0)
+                        {
+                            bits = generator();
+                        }
+                        id[i] = hexDigits[bits & 0xf];
+                        allZero = allZero && (bits & 0xf) == 0;
+                        bits >>= 4;
+                    }
+
+                    // An all-zero id is invalid in the W3C spec
+                    if (allZero)
+                    {
+                        id[hexLength - 1] = '1';
+                    }
+                    return id;
+                }
+
+                Json::Value stringAttribute(const std::string &key, const std::string &value)
+                {
+                    Json::Value attribute;
+                    attribute["key"] = key;
+                    attribute["value"]["stringValue"] = value;
+                    return attribute;
+                }
+
+                std::string unixNanoseconds(const std::chrono::system_clock::time_point &time)
+                {
+                    // OTLP/JSON encodes 64-bit integers as strings
+                    return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+                }
+            }
+
+            bool TraceContext::isValid() const
+            {
+                return m_traceId.size() == 32 && m_spanId.size() == 16;
+            }
+
+            std::string TraceContext::toTraceparent() const
+            {
+                // Version 00, and the sampled flag: every span that is started is also exported
+                return "00-" + m_traceId + "-" + m_spanId + "-01";
+            }
+
+            TraceContext TraceContext::newTrace()
+            {
+                TraceContext context;
+                context.m_traceId = newRandomId(32);
+                context.m_spanId = newRandomId(16);
+                return context;
+            }
+
+            TraceContext TraceContext::newChild() const
+            {
+                TraceContext context;
+                context.m_traceId = m_traceId;
+                context.m_spanId = newRandomId(16);
+                return context;
+            }
+
+            OtlpJsonFileTraceSink::OtlpJsonFileTraceSink(const std::string &filePath, const std::string &serviceName)
+                : m_serviceName(serviceName), m_file(filePath, std::ofstream::out | std::ofstream::app)
+            {
+            }
+
+            void OtlpJsonFileTraceSink::exportSpan(const TraceSpan &span)
+            {
+                Json::Value otlpSpan;
+                otlpSpan["traceId"] = span.m_context.m_traceId;
+                otlpSpan["spanId"] = span.m_context.m_spanId;
+                if (!span.m_parentSpanId.empty())
+                {
+                    otlpSpan["parentSpanId"] = span.m_parentSpanId;
+                }
+                otlpSpan["name"] = span.m_name;
+                otlpSpan["kind"] = static_cast<int>(span.m_kind);
+                otlpSpan["startTimeUnixNano"] = unixNanoseconds(span.m_startTime);
+                otlpSpan["endTimeUnixNano"] = unixNanoseconds(span.m_endTime);
+
+                Json::Value &attributes = otlpSpan["attributes"] = Json::Value(Json::arrayValue);
+                for (const auto &attribute : span.m_stringAttributes)
+                {
+                    attributes.append(stringAttribute(attribute.first, attribute.second));
+                }
+                for (const auto &attribute : span.m_numberAttributes)
+                {
+                    Json::Value numberAttribute;
+                    numberAttribute["key"] = attribute.first;
+                    numberAttribute["value"]["doubleValue"] = attribute.second;
+                    attributes.append(numberAttribute);
+                }
+                otlpSpan["status"]["code"] = span.m_isError ? 2 : 0; // STATUS_CODE_ERROR or STATUS_CODE_UNSET
+
+                Json::Value request;
+                Json::Value &resourceSpans = request["resourceSpans"][0];
+                resourceSpans["resource"]["attributes"].append(stringAttribute("service.name", m_serviceName));
+                Json::Value &scopeSpans = resourceSpans["scopeSpans"][0];
+                scopeSpans["scope"]["name"] = "gsdk";
+                scopeSpans["spans"].append(otlpSpan);
+
+                Json::StreamWriterBuilder jsonWriterFactory;
+                jsonWriterFactory["indentation"] = "";
+                const std::string line = Json::writeString(jsonWriterFactory, request);
+
+                std::lock_guard<std::mutex> lock(m_fileMutex);
+                m_file << line << std::endl;
+            }
+
+            void GSDKTrace::setSink(std::shared_ptr<ITraceSink> sink)
+            {
+                std::lock_guard<std::mutex> lock(m_sinkMutex);
+                m_sink = sink;
+                m_exporting = (sink != nullptr);
+            }
+
+            bool GSDKTrace::isExporting()
+            {
+                return m_exporting;
+            }
+
+            void GSDKTrace::exportSpan(const TraceSpan &span)
+            {
+                if (!m_exporting)
+                {
+                    return;
+                }
+
+                std::shared_ptr<ITraceSink> sink;
+                {
+                    std::lock_guard<std::mutex> lock(m_sinkMutex);
+                    sink = m_sink;
+                }
+
+                // Outside the lock, so a slow sink only holds up its own caller
+                if (sink != nullptr)
+                {
+                    sink->exportSpan(span);
+                }
+            }
+
+            const TraceContext &GSDKTrace::getCurrentContext()
+            {
+                return currentContext;
+            }
+
+            ScopedTraceContext::ScopedTraceContext(const TraceContext &context) : m_previousContext(currentContext)
+            {
+                currentContext = context;
+            }
+
+            ScopedTraceContext::~ScopedTraceContext()
+            {
+                currentContext = m_previousContext;
+            }
+        }
+    }
+}
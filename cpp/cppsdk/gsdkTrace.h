@@ -0,0 +1,128 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <fstream>
+#include <atomic>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            /// <summary>
+            /// A W3C trace context (https://www.w3.org/TR/trace-context/): the trace a piece of work belongs to, and the span it runs in.
+            /// </summary>
+            class TraceContext
+            {
+            public:
+                std::string m_traceId; // 32 lowercase hex characters, empty when there is no trace
+                std::string m_spanId;  // 16 lowercase hex characters
+
+                bool isValid() const;
+
+                /// <summary>The value of the traceparent header for requests made in this span, e.g. "00-{trace id}-{span id}-01".</summary>
+                std::string toTraceparent() const;
+
+                /// <summary>A root span of a new trace.</summary>
+                static TraceContext newTrace();
+
+                /// <summary>A new span in the same trace, to be a child of this one.</summary>
+                TraceContext newChild() const;
+            };
+
+            enum class TraceSpanKind
+            {
+                Internal = 1, // Values match OpenTelemetry's SpanKind
+                Client = 3
+            };
+
+            /// <summary>
+            /// A finished span, as handed to the trace sink.
+            /// </summary>
+            class TraceSpan
+            {
+            public:
+                std::string m_name;
+                TraceSpanKind m_kind = TraceSpanKind::Internal;
+                TraceContext m_context;
+                std::string m_parentSpanId; // Empty for the root span of a trace
+                std::chrono::system_clock::time_point m_startTime;
+                std::chrono::system_clock::time_point m_endTime;
+                bool m_isError = false;
+                std::map<std::string, std::string> m_stringAttributes;
+                std::map<std::string, double> m_numberAttributes; // Durations are in milliseconds
+            };
+
+            /// <summary>
+            /// Receives every finished span. Called from the thread that finished it, so implementations must be thread safe.
+            /// </summary>
+            class ITraceSink
+            {
+            public:
+                virtual ~ITraceSink() {}
+                virtual void exportSpan(const TraceSpan &span) = 0;
+            };
+
+            /// <summary>
+            /// Appends spans to a file in OTLP/JSON, one ExportTraceServiceRequest per line, the format of OpenTelemetry's file exporter.
+            /// </summary>
+            class OtlpJsonFileTraceSink : public ITraceSink
+            {
+            public:
+                OtlpJsonFileTraceSink(const std::string &filePath, const std::string &serviceName = "gsdk");
+                void exportSpan(const TraceSpan &span) override;
+
+            private:
+                const std::string m_serviceName;
+                std::mutex m_fileMutex;
+                std::ofstream m_file;
+            };
+
+            /// <summary>
+            /// Where finished spans go, and which trace context is current on each thread.
+            /// The GSDK starts a trace when the server is allocated, and PlayFab API calls join the trace that is current on the calling thread.
+            /// </summary>
+            class GSDKTrace
+            {
+            public:
+                /// <summary>Sends finished spans to the sink from now on. nullptr (the default) stops exporting.</summary>
+                static void setSink(std::shared_ptr<ITraceSink> sink);
+                static bool isExporting();
+                static void exportSpan(const TraceSpan &span);
+
+                /// <summary>The trace context current on this thread, invalid if there is none.</summary>
+                static const TraceContext &getCurrentContext();
+
+            private:
+                GSDKTrace() = delete;
+
+                static std::shared_ptr<ITraceSink> m_sink;
+                static std::mutex m_sinkMutex;
+                static std::atomic<bool> m_exporting;
+            };
+
+            /// <summary>
+            /// Makes a trace context current on this thread until the end of the scope, so the calls made in the scope join its trace.
+            /// </summary>
+            class ScopedTraceContext
+            {
+            public:
+                explicit ScopedTraceContext(const TraceContext &context);
+                ~ScopedTraceContext();
+
+                ScopedTraceContext(const ScopedTraceContext &) = delete;
+                ScopedTraceContext &operator=(const ScopedTraceContext &) = delete;
+
+            private:
+                TraceContext m_previousContext;
+            };
+        }
+    }
+}
@@ -14,6 +14,8 @@
 #include "sys/stat.h"
 #include "sys/types.h"
 #include "unistd.h"
+#include "fcntl.h"
+#include "sys/mman.h"
 #endif
 
 namespace Microsoft
@@ -80,6 +82,93 @@ namespace Microsoft
                 #endif
             }
 
+            cMappedFile::cMappedFile(const std::string &path) : m_isOpen(false), m_data(nullptr), m_size(0)
+            {
+                #ifdef GSDK_LINUX
+                int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0)
+                {
+                    return;
+                }
+
+                struct stat fileStat;
+                if (fstat(fd, &fileStat) == 0)
+                {
+                    m_size = static_cast<size_t>(fileStat.st_size);
+                    if (m_size == 0)
+                    {
+                        m_isOpen = true;
+                    }
+                    else
+                    {
+                        void *view = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if (view != MAP_FAILED)
+                        {
+                            m_data = static_cast<const char*>(view);
+                            m_isOpen = true;
+                        }
+                    }
+                }
+
+                // The mapping keeps its own reference to the file
+                ::close(fd);
+                #else
+                m_mapping = nullptr;
+                m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (m_file == INVALID_HANDLE_VALUE)
+                {
+                    return;
+                }
+
+                LARGE_INTEGER fileSize;
+                if (GetFileSizeEx(m_file, &fileSize))
+                {
+                    m_size = static_cast<size_t>(fileSize.QuadPart);
+                    if (m_size == 0)
+                    {
+                        m_isOpen = true;
+                    }
+                    else
+                    {
+                        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                        if (m_mapping != nullptr)
+                        {
+                            m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+                            m_isOpen = m_data != nullptr;
+                        }
+                    }
+                }
+                #endif
+
+                if (!m_isOpen)
+                {
+                    m_size = 0;
+                }
+            }
+
+            cMappedFile::~cMappedFile()
+            {
+                #ifdef GSDK_LINUX
+                if (m_data != nullptr)
+                {
+                    munmap(const_cast<char*>(m_data), m_size);
+                }
+                #else
+                if (m_data != nullptr)
+                {
+                    UnmapViewOfFile(m_data);
+                }
+                if (m_mapping != nullptr)
+                {
+                    CloseHandle(m_mapping);
+                }
+                if (m_file != INVALID_HANDLE_VALUE)
+                {
+                    CloseHandle(m_file);
+                }
+                #endif
+            }
+
         }
     }
 }
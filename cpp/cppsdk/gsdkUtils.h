@@ -57,6 +57,33 @@ namespace Microsoft
                 static time_t tm2timet_utc(struct tm *tm);
             };
 
+            /// <summary>
+            /// A read-only view of a whole file, mapped into memory rather than read through a stream buffer.
+            /// The view stays valid until the object is destroyed. An empty file opens with a null data() and a size() of 0.
+            /// </summary>
+            class cMappedFile
+            {
+            public:
+                explicit cMappedFile(const std::string &path);
+                ~cMappedFile();
+
+                cMappedFile(const cMappedFile &) = delete;
+                cMappedFile &operator=(const cMappedFile &) = delete;
+
+                bool isOpen() const { return m_isOpen; }
+                const char *data() const { return m_data; }
+                size_t size() const { return m_size; }
+
+            private:
+                bool m_isOpen;
+                const char *m_data;
+                size_t m_size;
+#ifdef GSDK_WINDOWS
+                HANDLE m_file;
+                HANDLE m_mapping;
+#endif
+            };
+
         }
     }
 }
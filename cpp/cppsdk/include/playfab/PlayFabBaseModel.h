@@ -5,6 +5,7 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 
 #include <sstream>
 #include <iomanip>
@@ -72,7 +73,7 @@ namespace PlayFab
     /// Base class for all PlayFab Results
     /// </summary>
     struct PlayFabResultCommon : public PlayFabBaseModel {
-        Json::Value Request;
+        std::shared_ptr<const Json::Value> Request; // The request this is the result of, null when PlayFabSettings::keepRequestJson is off
     };
 
     // Utilities for [de]serializing time_t to/from json
@@ -98,9 +99,13 @@ namespace PlayFab
         tm timeStruct = {};
         std::istringstream iss(enumStr.c_str());
         iss >> std::get_time(&timeStruct, "%Y-%m-%dT%T");
-        timeStruct.tm_year -= 1900;
-        timeStruct.tm_mon -= 1;
-        output = mktime(&timeStruct);
+        // PlayFab times are UTC, as written by ToJsonUtilT
+#ifdef GSDK_WINDOWS
+        output = _mkgmtime(&timeStruct);
+#endif
+#ifdef GSDK_LINUX
+        output = timegm(&timeStruct);
+#endif
     }
     inline void ToJsonUtilT(const Boxed<time_t>& input, Json::Value& output)
     {
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <playfab/PlayFabHttp.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+
+namespace PlayFab
+{
+    struct PlayFabBulkSettings
+    {
+        size_t maxConcurrency = 8; // Requests in flight at once
+        double maxRequestsPerSecond = 0; // Cap on the rate requests are issued at, 0 for no cap
+        unsigned int maxAttempts = 3; // Attempts per item, including the first, when the error is transient
+        unsigned int retryDelayMs = 500; // Delay before the first retry, doubled for each retry after that
+        unsigned int maxRetryDelayMs = 30000; // Retry delays stop doubling once they reach this
+    };
+
+    // Retry delays stop doubling after this many retries, which also keeps the shift in range for large maxAttempts
+    constexpr unsigned int c_maxBulkRetryDoublings = 16;
+
+    /// <summary>
+    /// Runs one generated API method over a list of requests with a bounded number of requests in flight,
+    /// and reports every item's result or error with a single completion callback:
+    ///   auto bulk = MakeBulkExecutor(&PlayFabServerAPI::GrantItemsToUser);
+    ///   bulk->Run(std::move(requests), [](const auto& results) { ... });
+    /// Throttled requests also hold back the rest of the run for the retry delay.
+    /// </summary>
+    template<typename RequestType, typename ResultType>
+    class PlayFabBulkExecutor
+    {
+    public:
+        typedef void(*ApiMethod)(RequestType& request, ProcessApiCallback<ResultType> callback, ErrorCallback errorCallback, void* customData);
+
+        struct ItemResult
+        {
+            bool succeeded = false;
+            unsigned int attempts = 0;
+            ResultType result;
+            PlayFabError error; // The error of the last attempt, when the item failed
+        };
+
+        // Called once all items have completed, from the thread that completed the last one (or from Run, if there were no items).
+        // Must not call Wait on the executor that is calling it.
+        typedef std::function<void(const std::vector<ItemResult>& results)> CompletionCallback;
+
+        explicit PlayFabBulkExecutor(ApiMethod apiMethod, const PlayFabBulkSettings& settings = PlayFabBulkSettings())
+            : method(apiMethod), bulkSettings(settings)
+        {
+            if (bulkSettings.maxConcurrency == 0)
+                bulkSettings.maxConcurrency = 1;
+            if (bulkSettings.maxAttempts == 0)
+                bulkSettings.maxAttempts = 1;
+        }
+
+        ~PlayFabBulkExecutor()
+        {
+            Wait();
+        }
+
+        // Starts issuing the requests in the background. Waits for the previous run of this executor to finish first.
+        void Run(std::vector<RequestType> requests, CompletionCallback onComplete)
+        {
+            Wait();
+
+            state = std::make_shared<RunState>();
+            state->requests = std::move(requests);
+            state->results.resize(state->requests.size());
+            state->remaining = state->requests.size();
+            state->onComplete = std::move(onComplete);
+            for (size_t i = 0; i < state->requests.size(); ++i)
+                state->ready.push_back(i);
+
+            if (state->remaining == 0)
+            {
+                Finish(state);
+                return;
+            }
+
+            driverThread = std::thread(&PlayFabBulkExecutor::Drive, state, method, bulkSettings);
+        }
+
+        bool IsComplete() const
+        {
+            if (state == nullptr)
+                return true;
+
+            std::unique_lock<std::mutex> lock(state->mutex);
+            return state->completed;
+        }
+
+        // Blocks until the current run has completed and its completion callback has returned.
+        // When PlayFabSettings::threadedCallbacks is false, results are only delivered by PlayFabHttp::Update, so pump it instead of waiting here.
+        void Wait()
+        {
+            if (driverThread.joinable())
+                driverThread.join();
+
+            if (state != nullptr)
+            {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                state->condition.wait(lock, [this]() { return state->completed; });
+            }
+        }
+
+    private:
+        PlayFabBulkExecutor(const PlayFabBulkExecutor& other); // Private copy-constructor, the executor owns its run
+
+        typedef std::chrono::steady_clock Clock;
+
+        // Shared with the request callbacks, so it outlives the executor if they complete late
+        struct RunState
+        {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::vector<RequestType> requests;
+            std::vector<ItemResult> results;
+            std::deque<size_t> ready;
+            std::multimap<Clock::time_point, size_t> retries; // Items waiting for their retry delay, by due time
+            Clock::time_point nextIssue;
+            size_t inFlight = 0;
+            size_t remaining = 0;
+            bool completed = false;
+            CompletionCallback onComplete;
+        };
+
+        static void Drive(std::shared_ptr<RunState> run, ApiMethod method, PlayFabBulkSettings settings)
+        {
+            const auto issueInterval = settings.maxRequestsPerSecond > 0
+                ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / settings.maxRequestsPerSecond))
+                : Clock::duration::zero();
+
+            std::unique_lock<std::mutex> lock(run->mutex);
+            run->nextIssue = Clock::now();
+
+            while (run->remaining > 0)
+            {
+                const auto now = Clock::now();
+                while (!run->retries.empty() && run->retries.begin()->first <= now)
+                {
+                    run->ready.push_back(run->retries.begin()->second);
+                    run->retries.erase(run->retries.begin());
+                }
+
+                const bool canIssue = !run->ready.empty() && run->inFlight < settings.maxConcurrency;
+                if (canIssue && now >= run->nextIssue)
+                {
+                    const size_t index = run->ready.front();
+                    run->ready.pop_front();
+                    ++run->inFlight;
+                    ++run->results[index].attempts;
+                    run->nextIssue = now + issueInterval;
+
+                    // The generated methods take the request by non-const reference, so hand them a copy to keep it intact for retries
+                    RequestType request = run->requests[index];
+                    lock.unlock();
+                    method(request,
+                        [run, index](const ResultType& result, void*) { OnItemSucceeded(run, index, result); },
+                        [run, index, settings](const PlayFabError& error, void*) { OnItemFailed(run, index, settings, error); },
+                        nullptr);
+                    lock.lock();
+                    continue;
+                }
+
+                auto wakeTime = Clock::time_point::max();
+                if (!run->retries.empty())
+                    wakeTime = run->retries.begin()->first;
+                if (canIssue && run->nextIssue < wakeTime)
+                    wakeTime = run->nextIssue;
+
+                if (wakeTime == Clock::time_point::max())
+                    run->condition.wait(lock);
+                else
+                    run->condition.wait_until(lock, wakeTime);
+            }
+        }
+
+        static void OnItemSucceeded(const std::shared_ptr<RunState>& run, size_t index, const ResultType& result)
+        {
+            bool finished;
+
+            { // LOCK run->mutex
+                std::unique_lock<std::mutex> lock(run->mutex);
+                ItemResult& item = run->results[index];
+                item.succeeded = true;
+                item.result = result;
+                --run->inFlight;
+                finished = --run->remaining == 0;
+            } // UNLOCK run->mutex
+
+            run->condition.notify_all();
+            if (finished)
+                Finish(run);
+        }
+
+        static void OnItemFailed(const std::shared_ptr<RunState>& run, size_t index, const PlayFabBulkSettings& settings, const PlayFabError& error)
+        {
+            bool finished = false;
+
+            { // LOCK run->mutex
+                std::unique_lock<std::mutex> lock(run->mutex);
+                ItemResult& item = run->results[index];
+                --run->inFlight;
+
+                if (error.IsTransient() && item.attempts < settings.maxAttempts)
+                {
+                    const auto retryDelayMs = (std::min)(static_cast<std::chrono::milliseconds::rep>(settings.retryDelayMs) << (std::min)(item.attempts - 1, c_maxBulkRetryDoublings),
+                        static_cast<std::chrono::milliseconds::rep>(settings.maxRetryDelayMs));
+                    const auto retryTime = Clock::now() + std::chrono::milliseconds(retryDelayMs);
+                    run->retries.emplace(retryTime, index);
+
+                    // Throttling applies to the whole title, so back off everything rather than just this item
+                    if (error.HttpCode == 429 && run->nextIssue < retryTime)
+                        run->nextIssue = retryTime;
+                }
+                else
+                {
+                    item.error = error;
+                    finished = --run->remaining == 0;
+                }
+            } // UNLOCK run->mutex
+
+            run->condition.notify_all();
+            if (finished)
+                Finish(run);
+        }
+
+        static void Finish(const std::shared_ptr<RunState>& run)
+        {
+            // Nothing touches the results once the last item is done, so they can be handed out without the lock
+            if (run->onComplete != nullptr)
+                run->onComplete(run->results);
+
+            { // LOCK run->mutex
+                std::unique_lock<std::mutex> lock(run->mutex);
+                run->completed = true;
+            } // UNLOCK run->mutex
+
+            run->condition.notify_all();
+        }
+
+        ApiMethod method;
+        PlayFabBulkSettings bulkSettings;
+        std::shared_ptr<RunState> state;
+        std::thread driverThread;
+    };
+
+    // Deduces the request and result types from a generated API method, e.g. MakeBulkExecutor(&PlayFabServerAPI::GrantItemsToUser)
+    template<typename RequestType, typename ResultType>
+    std::unique_ptr<PlayFabBulkExecutor<RequestType, ResultType>> MakeBulkExecutor(
+        void(*apiMethod)(RequestType&, ProcessApiCallback<ResultType>, ErrorCallback, void*),
+        const PlayFabBulkSettings& settings = PlayFabBulkSettings())
+    {
+        return std::unique_ptr<PlayFabBulkExecutor<RequestType, ResultType>>(new PlayFabBulkExecutor<RequestType, ResultType>(apiMethod, settings));
+    }
+}
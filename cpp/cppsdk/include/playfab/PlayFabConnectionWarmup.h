@@ -0,0 +1,56 @@
+#pragma once
+
+#include <playfab/PlayFabHttp.h>
+#include <condition_variable>
+#include <gsdkEvents.h>
+
+namespace PlayFab
+{
+    struct PlayFabWarmupSettings
+    {
+        size_t connectionCount = 0; // Connections to open, 0 for one per PlayFabHttp worker (PlayFabSettings::maxConcurrentRequests)
+        unsigned int keepAliveIntervalSeconds = 45; // How often idle connections are used, so neither end closes them
+        bool stopOnAllocation = false; // Stop once the GSDK reports the allocation. Only takes effect when Start is called after GSDK::start(), since the warm-up never starts the GSDK itself.
+    };
+
+    /// <summary>
+    /// Opt-in warm-up of the connections to the PlayFab host: resolves it, connects and completes the TLS handshakes
+    /// ahead of time and keeps the connections alive, so the first calls after allocation do not pay for any of that.
+    /// Start it while the server is Initializing, e.g. right after GSDK::start(), and Stop it once the server is allocated,
+    /// or let it stop itself with PlayFabWarmupSettings::stopOnAllocation.
+    /// PlayFabSettings::titleId must be set first.
+    /// </summary>
+    class PlayFabConnectionWarmup
+    {
+    public:
+        enum class Status
+        {
+            NotStarted,
+            WarmingUp,
+            Warm,
+            Failed // No connection could be opened. Warm-up is attempted again at the next keep-alive interval.
+        };
+
+        // Warms the connections on a background thread and keeps them alive until Stop. Does nothing if already started.
+        static void Start(const PlayFabWarmupSettings& settings = PlayFabWarmupSettings());
+        // Safe to call from several threads at once, and while stopOnAllocation stops it too
+        static void Stop();
+
+        static Status GetStatus();
+        static bool IsWarm();
+
+    private:
+        PlayFabConnectionWarmup(); // Private constructor, static class should never have an instance
+        PlayFabConnectionWarmup(const PlayFabConnectionWarmup& other); // Private copy-constructor, static class should never have an instance
+
+        static void KeepAliveThread(PlayFabWarmupSettings settings, unsigned int generation);
+
+        static std::mutex warmupMutex;
+        static std::condition_variable stopCondition;
+        static std::thread keepAliveThread;
+        static bool keepAliveRunning;
+        static unsigned int keepAliveGeneration; // Changed by every Start and Stop, so a keep-alive thread knows when it has been stopped
+        static Status status;
+        static Microsoft::Azure::Gaming::GSDKSubscriptionId allocationSubscription; // 0 unless stopOnAllocation
+    };
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <playfab/PlayFabHttp.h>
+#include <playfab/PlayFabBaseModel.h>
+
+namespace PlayFab
+{
+    struct PlayFabContextSettings
+    {
+        std::string titleId; // Found in the Game Manager for your title, at the PlayFab Website
+        bool useDevelopmentEnvironment = false;
+        std::string developmentEnvironmentURL = ".playfabsandbox.com";
+        std::string productionEnvironmentURL = ".playfabapi.com";
+        std::string developerSecretKey; // Required by the Server, Admin and Matchmaker APIs
+        size_t maxConcurrentRequests = 1; // Worker threads of the context's own PlayFabHttp, which bounds how many of its requests are in flight at once
+    };
+
+    /// <summary>
+    /// Everything one title or player session needs to call PlayFab: its settings, the credentials its logins return, and its own http transport.
+    /// The API overloads that take a context only use that context, so several of them can run calls side by side in one process.
+    /// The API overloads without one use Default(), which is backed by PlayFabSettings, IPlayFabHttp::Get() and PlayFabEntityTokenManager.
+    /// </summary>
+    class PlayFabContext
+    {
+    public:
+        explicit PlayFabContext(const PlayFabContextSettings& settings);
+        virtual ~PlayFabContext();
+
+        static PlayFabContext& Default();
+
+        virtual IPlayFabHttp& GetHttp();
+        virtual std::string GetUrl(const std::string& urlPath) const;
+        virtual std::string GetTitleId() const;
+        virtual std::string GetDeveloperSecretKey() const;
+
+        // Set by the Client API logins made through this context
+        virtual std::string GetClientSessionTicket() const;
+        virtual void SetClientSessionTicket(const std::string& sessionTicket);
+        // Set by the logins and GetEntityToken calls made through this context
+        virtual std::string GetEntityToken() const;
+        virtual void SetEntityToken(const std::string& token, const Boxed<time_t>& expiration);
+        virtual void ForgetAllCredentials();
+
+        // Used by the Entity API methods, to authenticate with the context's entity token
+        virtual void AddEntityRequest(const std::string& urlPath, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData);
+
+    protected:
+        PlayFabContext(); // For the default context, which keeps everything in the static PlayFab classes instead
+
+    private:
+        PlayFabContext(const PlayFabContext& other); // Private copy-constructor, a context owns its transport
+
+        const PlayFabContextSettings settings;
+        const std::string serverUrl; // Built once from the settings
+        mutable std::mutex credentialsMutex;
+        std::string clientSessionTicket;
+        std::string entityToken;
+        // Last, so it is destroyed first: its threads still run callbacks that store credentials in this context
+        std::unique_ptr<IPlayFabHttp> http;
+    };
+}
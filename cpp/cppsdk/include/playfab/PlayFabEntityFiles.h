@@ -0,0 +1,70 @@
+#pragma once
+
+#ifdef ENABLE_PLAYFABENTITY_API
+
+#include <playfab/PlayFabEntityApi.h>
+
+namespace PlayFab
+{
+    struct PlayFabFileTransferSettings
+    {
+        size_t maxBytesPerSecond = 0; // Cap on each transfer's combined rate, so it does not compete with game traffic. 0 for no cap
+        size_t downloadChunkSize = 8 * 1024 * 1024; // Downloads larger than this are fetched as byte ranges of this size
+        size_t maxParallelChunks = 4; // Ranges of one download that are fetched at once
+        unsigned int maxAttempts = 3; // Attempts per upload or download range for transient failures. Download ranges resume from the last byte received
+        long lowSpeedTimeoutSeconds = 30; // Give up on an attempt that stays below 1 byte/s for this long
+    };
+
+    struct PlayFabFileUpload
+    {
+        std::string fileName; // The name of the file on the entity
+        std::string localPath;
+    };
+
+    /// <summary>
+    /// Streams entity files between disk and the URLs returned by InitiateFileUploads and GetFiles.
+    /// Files are memory mapped rather than read into memory, and the transfers run on background threads.
+    /// Transfer results and failures are reported from the transfer thread, PlayFab API results and errors as usual.
+    /// </summary>
+    class PlayFabEntityFiles
+    {
+    public:
+        // Read at the start of each operation
+        static PlayFabFileTransferSettings transferSettings;
+
+        // Initiates the uploads, streams each file to its upload URL and finalizes them. The uploads are aborted if any of them fails.
+        static void UploadFiles(const EntityModels::EntityKey& entity, const std::vector<PlayFabFileUpload>& files, ProcessApiCallback<EntityModels::FinalizeFileUploadsResponse> callback, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+
+        // Looks up the file on the entity and downloads it to localPath, in parallel ranges when it is larger than transferSettings.downloadChunkSize
+        static void DownloadFile(const EntityModels::EntityKey& entity, const std::string& fileName, const std::string& localPath, ProcessApiCallback<EntityModels::GetFileMetadata> callback, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+
+        // Blocks until every transfer that has been started has completed
+        static void WaitForTransfers();
+
+    private:
+        PlayFabEntityFiles(); // Private constructor, static class should never have an instance
+        PlayFabEntityFiles(const PlayFabEntityFiles& other); // Private copy-constructor, static class should never have an instance
+
+        friend class PlayFabEntityFilesTests;
+
+        struct ByteRange
+        {
+            size_t first;
+            size_t last;
+        };
+
+        static void StartTransfer(std::function<void()> transfer);
+        static void RunUploads(EntityModels::EntityKey entity, std::vector<PlayFabFileUpload> files, std::map<std::string, std::string> uploadUrls, PlayFabFileTransferSettings settings, ProcessApiCallback<EntityModels::FinalizeFileUploadsResponse> callback, ErrorCallback errorCallback, void* customData);
+        static void RunDownload(EntityModels::GetFileMetadata metadata, std::string localPath, PlayFabFileTransferSettings settings, ProcessApiCallback<EntityModels::GetFileMetadata> callback, ErrorCallback errorCallback, void* customData);
+        static bool UploadFile(const std::string& uploadUrl, const std::string& localPath, const PlayFabFileTransferSettings& settings, PlayFabError& outError);
+        static bool DownloadRange(const std::string& downloadUrl, int fd, ByteRange range, bool ranged, size_t maxBytesPerSecond, const PlayFabFileTransferSettings& settings, PlayFabError& outError);
+        static void SetCommonOptions(CURL* curlHandle, const std::string& url, const PlayFabFileTransferSettings& settings);
+        static void ReportError(const PlayFabError& error, ErrorCallback errorCallback, void* customData);
+        static PlayFabError MakeTransferError(const std::string& url, CURLcode result, long httpCode, const std::string& message);
+
+        static std::mutex transfersMutex;
+        static std::vector<std::future<void>> transfers;
+    };
+}
+
+#endif
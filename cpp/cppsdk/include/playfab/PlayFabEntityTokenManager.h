@@ -0,0 +1,81 @@
+#pragma once
+
+#include <playfab/PlayFabHttp.h>
+#include <playfab/PlayFabBaseModel.h>
+#include <condition_variable>
+#include <deque>
+
+#ifdef ENABLE_PLAYFABENTITY_API
+#include <playfab/PlayFabEntityDataModels.h>
+#endif
+
+namespace PlayFab
+{
+    /// <summary>
+    /// Owns the entity token that authenticates the Entity API.
+    /// The token and its expiration are replaced together as one immutable value, so readers never see half of an update.
+    /// Once started, it refreshes the token in the background ahead of its expiration, and Entity API calls made while
+    /// a refresh is in flight are held back and sent with the new token instead of failing with the old one.
+    /// </summary>
+    class PlayFabEntityTokenManager
+    {
+    public:
+        struct EntityToken
+        {
+            std::string token;
+            time_t expiration; // 0 when unknown
+        };
+
+        // Never null; the token is empty until one has been set
+        static std::shared_ptr<const EntityToken> GetToken();
+        static void SetToken(const std::string& token, time_t expiration = 0);
+        static void SetToken(const std::string& token, const Boxed<time_t>& expiration);
+        static void ClearToken();
+
+#ifdef ENABLE_PLAYFABENTITY_API
+        // Keeps the token fresh by calling GetEntityToken with tokenRequest refreshBeforeExpirySeconds before each expiration.
+        // Fetches a token straight away if there is none, or if its expiration is unknown.
+        static void Start(const EntityModels::GetEntityTokenRequest& tokenRequest, unsigned int refreshBeforeExpirySeconds = 300);
+        static void Stop();
+
+        // Fetches a new token now, unless a refresh is already in flight. Entity API calls are held back until it completes.
+        static void Refresh();
+        static bool IsRefreshing();
+
+        // Used by the Entity API methods in place of IPlayFabHttp::AddRequest, to authenticate with the current token
+        static void AddRequest(const std::string& urlPath, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData);
+#endif
+
+    private:
+        PlayFabEntityTokenManager(); // Private constructor, static class should never have an instance
+        PlayFabEntityTokenManager(const PlayFabEntityTokenManager& other); // Private copy-constructor, static class should never have an instance
+
+        static std::shared_ptr<const EntityToken> currentToken; // Only accessed through std::atomic_load/atomic_store
+
+#ifdef ENABLE_PLAYFABENTITY_API
+        struct HeldRequest
+        {
+            std::string urlPath;
+            Json::Value requestBody;
+            RequestCompleteCallback internalCallback;
+            SharedVoidPointer successCallback;
+            ErrorCallback errorCallback;
+            void* customData;
+            Microsoft::Azure::Gaming::TraceContext traceContext; // The trace the request was made in, which it still joins once sent
+        };
+
+        static void RefreshThread();
+        static void OnRefreshComplete(bool succeeded);
+
+        static std::mutex refreshMutex;
+        static std::condition_variable refreshCondition;
+        static std::thread refreshThread;
+        static bool refreshThreadRunning;
+        static bool refreshInFlight;
+        static std::chrono::steady_clock::time_point retryAfter; // Backs off the next refresh after a failed one
+        static std::deque<HeldRequest> heldRequests;
+        static EntityModels::GetEntityTokenRequest refreshRequest;
+        static unsigned int refreshMarginSeconds;
+#endif
+    };
+}
@@ -389,12 +389,15 @@ namespace PlayFab
         Json::Value Data;
         // Non-serialized fields
         std::string UrlPath;
-        Json::Value Request;
+        std::shared_ptr<const Json::Value> Request; // Shared with the result, null when PlayFabSettings::keepRequestJson is off
 
         void FromJson(Json::Value& input) override;
         Json::Value ToJson() const override;
 
         std::string GenerateReport() const;
+
+        // True for failures worth retrying unchanged: timeouts, throttling and service-side errors
+        bool IsTransient() const;
     };
 
     typedef std::function<void(const PlayFabError& error, void* customData)> ErrorCallback;
@@ -1,18 +1,38 @@
 #pragma once
 
 #include <gsdkCommonPch.h>
+#include <gsdkTrace.h>
 
 #include <playfab/PlayFabError.h>
 #include <functional>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <unordered_map>
 
 namespace PlayFab
 {
     struct CallRequestContainer;
+    class PlayFabContext;
     typedef void(*RequestCompleteCallback)(CallRequestContainer& reqContainer);
     typedef std::shared_ptr<void> SharedVoidPointer;
+    // Runs the given work at some later point, on any thread
+    typedef std::function<void(std::function<void()> work)> CallbackExecutor;
+
+    /// <summary>
+    /// How long the success and error callbacks of one API method have taken, including unpacking the result they are given
+    /// </summary>
+    struct PlayFabCallbackMetrics
+    {
+        size_t callbackCount = 0;
+        std::chrono::microseconds totalDuration = std::chrono::microseconds::zero();
+        std::chrono::microseconds maxDuration = std::chrono::microseconds::zero();
+    };
 
     /// <summary>
     /// Internal PlayFabHttp container for each api call
@@ -20,10 +40,12 @@ namespace PlayFab
     struct CallRequestContainer
     {
         // I own these objects, I must always destroy them
-        CURL* curlHandle;
-        curl_slist* curlHttpHeaders;
-        // I never own this, I can never destroy it
+        curl_slist* curlHttpHeaders; // Only the request's own headers (auth, traceparent), linked in front of PlayFabHttp's shared static headers
+        curl_slist* curlHttpHeadersTail; // The last of the request's own headers, which points at the shared ones
+        // I never own these, I can never destroy them
+        CURL* curlHandle; // The sending worker's handle while the request is in flight, null otherwise
         void* customData;
+        PlayFabContext* context; // The context the request was sent through, for result handlers that store credentials in it
 
         bool finished;
         std::string authKey;
@@ -35,10 +57,44 @@ namespace PlayFab
         SharedVoidPointer successCallback;
         ErrorCallback errorCallback;
 
+        // The request's span, which is only valid when it is part of a trace, and the times it is made of
+        Microsoft::Azure::Gaming::TraceContext traceContext;
+        std::string parentSpanId;
+        std::chrono::system_clock::time_point queuedTime;
+        std::chrono::steady_clock::time_point queuedClock;
+        std::chrono::steady_clock::time_point sentClock;
+        std::chrono::steady_clock::time_point receivedClock;
+
         CallRequestContainer();
         ~CallRequestContainer();
     };
 
+    template<typename ResultType>
+    void KeepNothingFromResult(CallRequestContainer&, const ResultType&)
+    {
+    }
+
+    /// <summary>
+    /// The RequestCompleteCallback of every generated API method: unpacks the response as ResultType and passes it to the
+    /// caller's ProcessApiCallback<ResultType>. Methods with the same result type share one instantiation.
+    /// OnResult runs first, for the few methods that keep something from their result, like the credentials returned by a login.
+    /// </summary>
+    template<typename ResultType, void(*OnResult)(CallRequestContainer&, const ResultType&) = KeepNothingFromResult<ResultType>>
+    void DispatchResult(CallRequestContainer& reqContainer)
+    {
+        ResultType outResult;
+        outResult.FromJson(reqContainer.errorWrapper.Data);
+        outResult.Request = reqContainer.errorWrapper.Request;
+        OnResult(reqContainer, outResult);
+
+        const auto internalPtr = reqContainer.successCallback.get();
+        if (internalPtr != nullptr)
+        {
+            const auto& callback = *static_cast<ProcessApiCallback<ResultType>*>(internalPtr);
+            callback(outResult, reqContainer.customData);
+        }
+    }
+
     /// <summary>
     /// Provides an interface and a static instance for https implementations
     /// </summary>
@@ -49,10 +105,20 @@ namespace PlayFab
 
         virtual ~IPlayFabHttp();
 
-        virtual void AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) = 0;
+        virtual void AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) = 0;
         virtual size_t Update() = 0;
+        // Handles up to maxResults waiting results in one go, and returns how many it handled
+        virtual size_t UpdateBatch(size_t maxResults);
+        // A non-blocking descriptor that polls readable while results are waiting for Update, for games that wait on their own epoll set.
+        // Never read it: Update and UpdateBatch reset it once the last waiting result is handled. -1 when not supported.
+        virtual int GetResultEventFd();
+        // Opens (or keeps alive) up to connectionCount connections to the PlayFab host for later requests to use. Blocks, and returns how many connections are ready.
+        virtual size_t WarmConnections(size_t connectionCount);
+        // Callback durations so far, keyed by API url path
+        virtual std::map<std::string, PlayFabCallbackMetrics> GetCallbackMetrics();
     protected:
         static std::unique_ptr<IPlayFabHttp> httpInstance;
+        static std::once_flag httpInstanceCreated;
     };
 
     /// <summary>
@@ -62,24 +128,72 @@ namespace PlayFab
     {
     public:
         static void MakeInstance();
+        // Sends requests to the context's PlayFab host, on workerCount worker threads
+        PlayFabHttp(PlayFabContext& context, size_t workerCount);
         ~PlayFabHttp() override;
 
-        void AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) override;
+        void AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) override;
         size_t Update() override;
+        size_t UpdateBatch(size_t maxResults) override;
+        int GetResultEventFd() override;
+        size_t WarmConnections(size_t connectionCount) override;
+        std::map<std::string, PlayFabCallbackMetrics> GetCallbackMetrics() override;
     private:
-        PlayFabHttp(); // Private constructor, to enforce singleton instance
-        PlayFabHttp(const PlayFabHttp& other); // Private copy-constructor, to enforce singleton instance
+        PlayFabHttp(const PlayFabHttp& other); // Private copy-constructor, the worker threads belong to one instance
+
+        // Everything about a request that only depends on its endpoint. Built by the first call to the endpoint and never changed after that.
+        struct RequestTemplate
+        {
+            std::string url;
+            curl_slist* staticHeaders; // The same for every endpoint, so one list is shared. Owned by PlayFabHttp.
+        };
 
         static size_t CurlReceiveData(char* buffer, size_t blockSize, size_t blockCount, void* userData);
-        static void ExecuteRequest(CallRequestContainer& reqContainer);
+        static void ParseResponse(CallRequestContainer& reqContainer);
+        void ExecuteRequest(CallRequestContainer& reqContainer, CURL* curlHandle);
+        bool WarmConnection(CURL* curlHandle);
+        const RequestTemplate& GetRequestTemplate(const std::string& urlPath);
+        void SetConnectionOptions(CURL* curlHandle);
+        static void CurlShareLock(CURL* curlHandle, curl_lock_data data, curl_lock_access access, void* userData);
+        static void CurlShareUnlock(CURL* curlHandle, curl_lock_data data, void* userData);
         void WorkerThread();
-        static void HandleCallback(CallRequestContainer& reqContainer);
-        static void HandleResults(CallRequestContainer& reqContainer);
+        void CallbackThread();
+        void HandleCallback(CallRequestContainer& reqContainer);
+        void HandleResults(CallRequestContainer& reqContainer);
+        static void ExportSpan(const CallRequestContainer& reqContainer, std::chrono::steady_clock::time_point callbackStart, std::chrono::steady_clock::time_point callbackEnd);
+        void SetResultsSignaled(bool signaled);
 
-        std::thread pfHttpWorkerThread;
+        PlayFabContext& context;
+        curl_slist* staticHeaders;
+        std::mutex requestTemplateMutex;
+        std::unordered_map<std::string, std::unique_ptr<const RequestTemplate>> requestTemplates;
+        // DNS lookups and TLS sessions are shared by every worker. Connections are not, as libcurl can't use one connection cache from several threads,
+        // so each worker keeps its connection in its own curl handle and reuses it for every request it sends.
+        CURLSH* curlShare;
+        std::mutex curlShareMutexes[CURL_LOCK_DATA_LAST];
+        std::vector<std::thread> pfHttpWorkerThreads;
         std::mutex httpRequestMutex;
-        bool threadRunning;
+        std::atomic<bool> threadRunning;
         std::vector<CallRequestContainer*> pendingRequests;
         std::vector<CallRequestContainer*> pendingResults;
+        int resultEventFd; // Readable exactly while pendingResults is non-empty, only changed under httpRequestMutex
+
+        // WarmConnections hands the warm-up to the workers, each of which warms the connection in its own handle at most once per round
+        std::mutex warmMutex; // Held for a whole WarmConnections call, so rounds never overlap
+        std::condition_variable warmCondition; // Used with httpRequestMutex, which guards the rest of these
+        unsigned int warmRound;
+        size_t warmSlotsLeft; // Workers that may still join the current round
+        size_t warmFinished;
+        size_t warmSucceeded;
+
+        // Threaded callbacks are handed off here, so the worker threads go straight back to sending requests
+        std::vector<std::thread> callbackWorkerThreads; // Started by the first threaded callback
+        std::mutex callbackMutex;
+        std::condition_variable callbackCondition;
+        bool callbackThreadsRunning;
+        std::deque<CallRequestContainer*> pendingCallbacks;
+
+        std::mutex metricsMutex;
+        std::map<std::string, PlayFabCallbackMetrics> callbackMetrics;
     };
 }
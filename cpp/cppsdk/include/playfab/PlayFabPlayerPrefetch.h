@@ -0,0 +1,66 @@
+#pragma once
+
+#ifdef ENABLE_PLAYFABSERVER_API
+
+#include <playfab/PlayFabServerApi.h>
+#include <gsdkEvents.h>
+#include <deque>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// Opt-in GSDK integration that fetches GetPlayerCombinedInfo for every initial player as soon as the
+    /// server is allocated, so player data is already cached when clients connect
+    /// </summary>
+    class PlayFabPlayerPrefetch
+    {
+    public:
+        enum class Status
+        {
+            NotRequested,
+            Pending,
+            Ready,
+            Failed
+        };
+
+        // Prefetches the initial players of every allocation, with at most maxParallelFetches requests in flight.
+        // Subscribes to the GSDK's allocation event, so it works alongside the game's own allocation callback.
+        // PlayFabSettings::maxConcurrentRequests must also be raised for the fetches to actually run in parallel.
+        static void Enable(const ServerModels::GetPlayerCombinedInfoRequestParams& infoRequestParameters, size_t maxParallelFetches = 4);
+        static void Disable();
+
+        // Starts a new session cache and queues a fetch for each player. Called from the GSDK heartbeat thread on allocation when enabled.
+        static void Prefetch(const std::vector<std::string>& playFabIds);
+
+        // Copies out the cached payload (or the error, if the fetch failed) for a player of the current session
+        static Status GetPlayerInfo(const std::string& playFabId, ServerModels::GetPlayerCombinedInfoResultPayload& outPayload, PlayFabError* outError = nullptr);
+        static bool IsComplete();
+        static void Clear();
+
+    private:
+        PlayFabPlayerPrefetch(); // Private constructor, static class should never have an instance
+        PlayFabPlayerPrefetch(const PlayFabPlayerPrefetch& other); // Private copy-constructor, static class should never have an instance
+
+        struct CacheEntry
+        {
+            Status status = Status::Pending;
+            ServerModels::GetPlayerCombinedInfoResultPayload payload;
+            PlayFabError error;
+        };
+
+        static void TakeQueuedFetches(std::vector<std::string>& outPlayFabIds);
+        static void IssueFetches(const std::vector<std::string>& playFabIds, size_t generation);
+        static void OnFetchComplete(size_t generation, const std::string& playFabId, const ServerModels::GetPlayerCombinedInfoResult* result, const PlayFabError* error);
+
+        static std::mutex cacheMutex;
+        static std::unordered_map<std::string, CacheEntry> cache;
+        static std::deque<std::string> queuedFetches;
+        static size_t fetchesInFlight;
+        static size_t maxFetchesInFlight;
+        static size_t sessionGeneration; // Bumped per session, so late results from a previous allocation are dropped
+        static ServerModels::GetPlayerCombinedInfoRequestParams requestParameters;
+        static Microsoft::Azure::Gaming::GSDKSubscriptionId allocationSubscription; // 0 when disabled
+    };
+}
+
+#endif
@@ -10,6 +10,15 @@ namespace PlayFab
     class PlayFabSettings
     {
     public:
+        // Stands in for the string PlayFabSettings::entityToken used to be: reading it or assigning to it goes to PlayFabEntityTokenManager
+        class EntityTokenForwarder
+        {
+        public:
+            operator std::string() const;
+            EntityTokenForwarder& operator=(const std::string& token);
+            bool empty() const;
+        };
+
         static const std::string sdkVersion;
         static const std::string buildIdentifier;
         static const std::string versionString;
@@ -23,7 +32,19 @@ namespace PlayFab
         // Control whether all callbacks are threaded or whether the user manually controlls callback timing from their main-thread
         static bool threadedCallbacks;
 
-        static std::string entityToken; // This is set by entity GetEntityToken method, and is required by all other Entity API methods
+        static EntityTokenForwarder entityToken; // Deprecated: the entity token is owned by PlayFabEntityTokenManager, use GetToken and SetToken there instead
+
+        // Number of PlayFabHttp worker threads, which bounds how many requests are in flight at once. Read when the http instance is created, so set it before the first API call
+        static size_t maxConcurrentRequests;
+
+        // Whether results and errors keep a reference to the request json they were sent with. Turn off to release request payloads as soon as they are sent
+        static bool keepRequestJson;
+
+        // With threadedCallbacks, callbacks run on this many PlayFabHttp callback threads, so slow callbacks never hold up the requests behind them
+        static size_t callbackThreads;
+        // With threadedCallbacks, hands callbacks to this executor instead of the callback threads, e.g. the game's own thread pool
+        static CallbackExecutor callbackExecutor;
+
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
         static std::string developerSecretKey; // You must set this value for PlayFabSdk to work properly (Found in the Game Manager for your title, at the PlayFab Website)
 #endif
@@ -44,9 +65,10 @@ namespace PlayFab
         PlayFabSettings(); // Private constructor, static class should never have an instance
         PlayFabSettings(const PlayFabSettings& other); // Private copy-constructor, static class should never have an instance
 
-        friend PlayFabHttp;
+        friend class DefaultPlayFabContext;
         static std::string GetUrl(const std::string& urlPath);
 
-        static std::string serverURL;
+        static std::string serverURL; // Built by the first GetUrl call, from the settings at that point
+        static std::once_flag serverURLBuilt;
     };
 }
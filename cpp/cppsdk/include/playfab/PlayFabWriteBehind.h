@@ -0,0 +1,93 @@
+#pragma once
+
+#ifdef ENABLE_PLAYFABSERVER_API
+
+#include <playfab/PlayFabServerApi.h>
+#include <condition_variable>
+#include <set>
+#include <gsdkEvents.h>
+
+namespace PlayFab
+{
+    enum class StatisticMergeMode
+    {
+        LastWriteWins,
+        Sum
+    };
+
+    struct PlayFabWriteBehindSettings
+    {
+        size_t maxPendingUpdates = 256; // Flush as soon as this many distinct player/key updates are buffered
+        unsigned int flushIntervalMs = 5000; // Flush at least this often while anything is buffered
+        StatisticMergeMode defaultStatisticMode = StatisticMergeMode::LastWriteWins;
+        std::unordered_map<std::string, StatisticMergeMode> statisticModes; // Per statistic name overrides of defaultStatisticMode
+        ErrorCallback errorCallback = nullptr; // Called for updates PlayFab rejected, which are dropped rather than retried
+        unsigned int retryDelayMs = 500; // Pause before FlushAndWait resends updates that failed transiently, doubled for each failed round
+        // Flush when the GSDK reports Terminate, before the game's shutdown callback runs. Only takes effect when Start is called after GSDK::start(),
+        // since write-behind never starts the GSDK itself. Without PlayFabSettings::threadedCallbacks this only sends the updates: the results need
+        // PlayFabHttp::Update, which isn't pumped on the GSDK's thread, so the game has to FlushAndWait from its own shutdown handling.
+        bool flushOnShutdown = true;
+        unsigned int shutdownFlushTimeoutMs = 10000; // How long that flush may hold up the shutdown
+    };
+
+    /// <summary>
+    /// Write-behind buffer for UpdatePlayerStatistics and UpdateUserData.
+    /// Coalesces updates per player and key in memory and sends each player's updates as one request per flush window
+    /// </summary>
+    class PlayFabWriteBehind
+    {
+    public:
+        static void Start(const PlayFabWriteBehindSettings& settings = PlayFabWriteBehindSettings());
+        // Flushes everything that is buffered and stops the flush thread
+        static void Stop(unsigned int timeoutMs = 10000);
+
+        static void SetStatistic(const std::string& playFabId, const std::string& statisticName, Int32 value);
+        static void SetUserData(const std::string& playFabId, const std::string& key, const std::string& value);
+        static void RemoveUserData(const std::string& playFabId, const std::string& key);
+
+        // Sends everything that is buffered without waiting for the results (e.g. at the end of a session)
+        static void Flush();
+        // Sends everything that is buffered and waits for all outstanding requests. Returns false on timeout.
+        // When PlayFabSettings::threadedCallbacks is false, this pumps PlayFabHttp::Update itself while it waits.
+        static bool FlushAndWait(unsigned int timeoutMs);
+
+        // Wraps a GSDK shutdown callback so buffered updates are flushed before it runs:
+        // GSDK::registerShutdownCallback(PlayFabWriteBehind::FlushBeforeShutdown(&onShutdown));
+        // Not needed with PlayFabWriteBehindSettings::flushOnShutdown, which flushes before any shutdown callback.
+        static std::function<void()> FlushBeforeShutdown(std::function<void()> shutdownCallback, unsigned int timeoutMs = 10000);
+
+    private:
+        PlayFabWriteBehind(); // Private constructor, static class should never have an instance
+        PlayFabWriteBehind(const PlayFabWriteBehind& other); // Private copy-constructor, static class should never have an instance
+
+        struct PendingPlayerUpdates
+        {
+            std::map<std::string, Int32> statistics;
+            std::map<std::string, std::string> userData;
+            std::set<std::string> userDataKeysToRemove;
+        };
+
+        static void FlushThread();
+        static void SendPending();
+        static void SendPlayerUpdates(const std::string& playFabId, const PendingPlayerUpdates& updates);
+        static void OnRequestComplete();
+        static void OnRequestFailed(const PlayFabError& error, const std::string& playFabId, const PendingPlayerUpdates& failedUpdates);
+        static StatisticMergeMode GetStatisticMode(const std::string& statisticName);
+        static void NotifyIfFull();
+
+        static std::mutex bufferMutex;
+        static std::condition_variable flushCondition;
+        static std::condition_variable requestsCompleteCondition;
+        static std::unordered_map<std::string, PendingPlayerUpdates> pendingUpdates;
+        static size_t pendingUpdateCount;
+        static size_t requestsInFlight;
+        static size_t transientFailureCount; // Requests that failed transiently and were put back in the buffer, ever
+        static bool flushRequested;
+        static bool flushThreadRunning;
+        static std::thread flushThread;
+        static PlayFabWriteBehindSettings writeBehindSettings;
+        static Microsoft::Azure::Gaming::GSDKSubscriptionId shutdownSubscription; // 0 unless flushOnShutdown
+    };
+}
+
+#endif
@@ -29,24 +29,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AbortTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAbortTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        AbortTaskInstance(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnAbortTaskInstanceResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::AbortTaskInstance(
+        PlayFabContext& context,
+        AbortTaskInstanceRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/AbortTaskInstance", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::AddNews(
@@ -56,24 +53,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddNews", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddNewsResult>(callback)), errorCallback, customData);
+        AddNews(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnAddNewsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::AddNews(
+        PlayFabContext& context,
+        AddNewsRequest& request,
+        ProcessApiCallback<AddNewsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddNewsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddNewsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/AddNews", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AddNewsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddNewsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::AddPlayerTag(
@@ -83,24 +77,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddPlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddPlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
+        AddPlayerTag(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnAddPlayerTagResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::AddPlayerTag(
+        PlayFabContext& context,
+        AddPlayerTagRequest& request,
+        ProcessApiCallback<AddPlayerTagResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddPlayerTagResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddPlayerTagResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/AddPlayerTag", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AddPlayerTagResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::AddServerBuild(
@@ -110,24 +101,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddServerBuildResult>(callback)), errorCallback, customData);
+        AddServerBuild(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnAddServerBuildResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::AddServerBuild(
+        PlayFabContext& context,
+        AddServerBuildRequest& request,
+        ProcessApiCallback<AddServerBuildResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddServerBuildResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddServerBuildResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/AddServerBuild", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AddServerBuildResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddServerBuildResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::AddUserVirtualCurrency(
@@ -137,24 +125,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        AddUserVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnAddUserVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::AddUserVirtualCurrency(
+        PlayFabContext& context,
+        AddUserVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyUserVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/AddUserVirtualCurrency", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyUserVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::AddVirtualCurrencyTypes(
@@ -164,24 +149,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
+        AddVirtualCurrencyTypes(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnAddVirtualCurrencyTypesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::AddVirtualCurrencyTypes(
+        PlayFabContext& context,
+        AddVirtualCurrencyTypesRequest& request,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        BlankResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<BlankResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/AddVirtualCurrencyTypes", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<BlankResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::BanUsers(
@@ -191,24 +173,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/BanUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnBanUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
+        BanUsers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnBanUsersResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::BanUsers(
+        PlayFabContext& context,
+        BanUsersRequest& request,
+        ProcessApiCallback<BanUsersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        BanUsersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<BanUsersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/BanUsers", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<BanUsersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::CheckLimitedEditionItemAvailability(
@@ -218,24 +197,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CheckLimitedEditionItemAvailability", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCheckLimitedEditionItemAvailabilityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
+        CheckLimitedEditionItemAvailability(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::CheckLimitedEditionItemAvailability(
+        PlayFabContext& context,
+        CheckLimitedEditionItemAvailabilityRequest& request,
+        ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CheckLimitedEditionItemAvailabilityResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/CheckLimitedEditionItemAvailability", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<CheckLimitedEditionItemAvailabilityResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
@@ -245,24 +221,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreateActionsOnPlayersInSegmentTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateActionsOnPlayersInSegmentTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
+        CreateActionsOnPlayersInSegmentTask(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
+        PlayFabContext& context,
+        CreateActionsOnPlayerSegmentTaskRequest& request,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreateTaskResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/CreateActionsOnPlayersInSegmentTask", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<CreateTaskResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::CreateCloudScriptTask(
@@ -272,24 +245,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreateCloudScriptTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateCloudScriptTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
+        CreateCloudScriptTask(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnCreateCloudScriptTaskResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::CreateCloudScriptTask(
+        PlayFabContext& context,
+        CreateCloudScriptTaskRequest& request,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreateTaskResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/CreateCloudScriptTask", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<CreateTaskResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::CreatePlayerSharedSecret(
@@ -299,24 +269,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreatePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreatePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerSharedSecretResult>(callback)), errorCallback, customData);
+        CreatePlayerSharedSecret(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnCreatePlayerSharedSecretResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::CreatePlayerSharedSecret(
+        PlayFabContext& context,
+        CreatePlayerSharedSecretRequest& request,
+        ProcessApiCallback<CreatePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreatePlayerSharedSecretResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreatePlayerSharedSecretResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/CreatePlayerSharedSecret", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<CreatePlayerSharedSecretResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerSharedSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::CreatePlayerStatisticDefinition(
@@ -326,24 +293,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreatePlayerStatisticDefinition", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreatePlayerStatisticDefinitionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
+        CreatePlayerStatisticDefinition(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::CreatePlayerStatisticDefinition(
+        PlayFabContext& context,
+        CreatePlayerStatisticDefinitionRequest& request,
+        ProcessApiCallback<CreatePlayerStatisticDefinitionResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreatePlayerStatisticDefinitionResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreatePlayerStatisticDefinitionResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/CreatePlayerStatisticDefinition", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<CreatePlayerStatisticDefinitionResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::DeleteContent(
@@ -353,24 +317,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteContent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteContentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
+        DeleteContent(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnDeleteContentResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::DeleteContent(
+        PlayFabContext& context,
+        DeleteContentRequest& request,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        BlankResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<BlankResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/DeleteContent", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<BlankResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::DeletePlayer(
@@ -380,24 +341,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeletePlayer", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeletePlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerResult>(callback)), errorCallback, customData);
+        DeletePlayer(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnDeletePlayerResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::DeletePlayer(
+        PlayFabContext& context,
+        DeletePlayerRequest& request,
+        ProcessApiCallback<DeletePlayerResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeletePlayerResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeletePlayerResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/DeletePlayer", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<DeletePlayerResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::DeletePlayerSharedSecret(
@@ -407,24 +365,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeletePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeletePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerSharedSecretResult>(callback)), errorCallback, customData);
+        DeletePlayerSharedSecret(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnDeletePlayerSharedSecretResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::DeletePlayerSharedSecret(
+        PlayFabContext& context,
+        DeletePlayerSharedSecretRequest& request,
+        ProcessApiCallback<DeletePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeletePlayerSharedSecretResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeletePlayerSharedSecretResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/DeletePlayerSharedSecret", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<DeletePlayerSharedSecretResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerSharedSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::DeleteStore(
@@ -434,24 +389,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteStore", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteStoreResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteStoreResult>(callback)), errorCallback, customData);
+        DeleteStore(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnDeleteStoreResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::DeleteStore(
+        PlayFabContext& context,
+        DeleteStoreRequest& request,
+        ProcessApiCallback<DeleteStoreResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeleteStoreResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeleteStoreResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/DeleteStore", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<DeleteStoreResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteStoreResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::DeleteTask(
@@ -461,24 +413,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        DeleteTask(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnDeleteTaskResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::DeleteTask(
+        PlayFabContext& context,
+        DeleteTaskRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/DeleteTask", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::DeleteTitle(
@@ -488,24 +437,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteTitle", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteTitleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleResult>(callback)), errorCallback, customData);
+        DeleteTitle(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnDeleteTitleResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::DeleteTitle(
+        PlayFabContext& context,
+        DeleteTitleRequest& request,
+        ProcessApiCallback<DeleteTitleResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeleteTitleResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeleteTitleResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/DeleteTitle", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<DeleteTitleResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
@@ -515,24 +461,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetActionsOnPlayersInSegmentTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetActionsOnPlayersInSegmentTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult>(callback)), errorCallback, customData);
+        GetActionsOnPlayersInSegmentTaskInstance(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
+        PlayFabContext& context,
+        GetTaskInstanceRequest& request,
+        ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetActionsOnPlayersInSegmentTaskInstanceResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetActionsOnPlayersInSegmentTaskInstance", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetActionsOnPlayersInSegmentTaskInstanceResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetAllSegments(
@@ -542,24 +485,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetAllSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
+        GetAllSegments(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetAllSegmentsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetAllSegments(
+        PlayFabContext& context,
+        GetAllSegmentsRequest& request,
+        ProcessApiCallback<GetAllSegmentsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetAllSegmentsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetAllSegmentsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetAllSegments", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetAllSegmentsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetCatalogItems(
@@ -569,24 +509,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
+        GetCatalogItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetCatalogItemsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetCatalogItems(
+        PlayFabContext& context,
+        GetCatalogItemsRequest& request,
+        ProcessApiCallback<GetCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCatalogItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCatalogItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetCatalogItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCatalogItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetCloudScriptRevision(
@@ -596,24 +533,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCloudScriptRevision", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptRevisionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptRevisionResult>(callback)), errorCallback, customData);
+        GetCloudScriptRevision(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetCloudScriptRevisionResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetCloudScriptRevision(
+        PlayFabContext& context,
+        GetCloudScriptRevisionRequest& request,
+        ProcessApiCallback<GetCloudScriptRevisionResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCloudScriptRevisionResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCloudScriptRevisionResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetCloudScriptRevision", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCloudScriptRevisionResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptRevisionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetCloudScriptTaskInstance(
@@ -623,24 +557,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCloudScriptTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptTaskInstanceResult>(callback)), errorCallback, customData);
+        GetCloudScriptTaskInstance(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetCloudScriptTaskInstance(
+        PlayFabContext& context,
+        GetTaskInstanceRequest& request,
+        ProcessApiCallback<GetCloudScriptTaskInstanceResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCloudScriptTaskInstanceResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCloudScriptTaskInstanceResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetCloudScriptTaskInstance", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCloudScriptTaskInstanceResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptTaskInstanceResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetCloudScriptVersions(
@@ -650,24 +581,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCloudScriptVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptVersionsResult>(callback)), errorCallback, customData);
+        GetCloudScriptVersions(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetCloudScriptVersionsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetCloudScriptVersions(
+        PlayFabContext& context,
+        GetCloudScriptVersionsRequest& request,
+        ProcessApiCallback<GetCloudScriptVersionsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCloudScriptVersionsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCloudScriptVersionsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetCloudScriptVersions", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCloudScriptVersionsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptVersionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetContentList(
@@ -677,24 +605,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetContentList", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentListResult>(callback)), errorCallback, customData);
+        GetContentList(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetContentListResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetContentList(
+        PlayFabContext& context,
+        GetContentListRequest& request,
+        ProcessApiCallback<GetContentListResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetContentListResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetContentListResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetContentList", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetContentListResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentListResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetContentUploadUrl(
@@ -704,24 +629,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetContentUploadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentUploadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentUploadUrlResult>(callback)), errorCallback, customData);
+        GetContentUploadUrl(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetContentUploadUrlResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetContentUploadUrl(
+        PlayFabContext& context,
+        GetContentUploadUrlRequest& request,
+        ProcessApiCallback<GetContentUploadUrlResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetContentUploadUrlResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetContentUploadUrlResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetContentUploadUrl", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetContentUploadUrlResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentUploadUrlResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetDataReport(
@@ -731,24 +653,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetDataReport", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetDataReportResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetDataReportResult>(callback)), errorCallback, customData);
+        GetDataReport(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetDataReportResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetDataReport(
+        PlayFabContext& context,
+        GetDataReportRequest& request,
+        ProcessApiCallback<GetDataReportResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetDataReportResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetDataReportResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetDataReport", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetDataReportResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetDataReportResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetMatchmakerGameInfo(
@@ -758,24 +677,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetMatchmakerGameInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetMatchmakerGameInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameInfoResult>(callback)), errorCallback, customData);
+        GetMatchmakerGameInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetMatchmakerGameInfoResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetMatchmakerGameInfo(
+        PlayFabContext& context,
+        GetMatchmakerGameInfoRequest& request,
+        ProcessApiCallback<GetMatchmakerGameInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetMatchmakerGameInfoResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetMatchmakerGameInfoResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetMatchmakerGameInfo", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetMatchmakerGameInfoResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetMatchmakerGameModes(
@@ -785,24 +701,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetMatchmakerGameModes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetMatchmakerGameModesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameModesResult>(callback)), errorCallback, customData);
+        GetMatchmakerGameModes(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetMatchmakerGameModesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetMatchmakerGameModes(
+        PlayFabContext& context,
+        GetMatchmakerGameModesRequest& request,
+        ProcessApiCallback<GetMatchmakerGameModesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetMatchmakerGameModesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetMatchmakerGameModesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetMatchmakerGameModes", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetMatchmakerGameModesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameModesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayerIdFromAuthToken(
@@ -812,24 +725,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerIdFromAuthToken", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerIdFromAuthTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerIdFromAuthTokenResult>(callback)), errorCallback, customData);
+        GetPlayerIdFromAuthToken(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayerIdFromAuthToken(
+        PlayFabContext& context,
+        GetPlayerIdFromAuthTokenRequest& request,
+        ProcessApiCallback<GetPlayerIdFromAuthTokenResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerIdFromAuthTokenResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerIdFromAuthTokenResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayerIdFromAuthToken", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerIdFromAuthTokenResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerIdFromAuthTokenResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayerProfile(
@@ -839,24 +749,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerProfile", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
+        GetPlayerProfile(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayerProfileResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayerProfile(
+        PlayFabContext& context,
+        GetPlayerProfileRequest& request,
+        ProcessApiCallback<GetPlayerProfileResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerProfileResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerProfileResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayerProfile", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerProfileResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayerSegments(
@@ -866,24 +773,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
+        GetPlayerSegments(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayerSegmentsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayerSegments(
+        PlayFabContext& context,
+        GetPlayersSegmentsRequest& request,
+        ProcessApiCallback<GetPlayerSegmentsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerSegmentsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerSegmentsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayerSegments", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerSegmentsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayerSharedSecrets(
@@ -893,24 +797,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerSharedSecrets", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSharedSecretsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSharedSecretsResult>(callback)), errorCallback, customData);
+        GetPlayerSharedSecrets(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayerSharedSecretsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayerSharedSecrets(
+        PlayFabContext& context,
+        GetPlayerSharedSecretsRequest& request,
+        ProcessApiCallback<GetPlayerSharedSecretsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerSharedSecretsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerSharedSecretsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayerSharedSecrets", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerSharedSecretsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSharedSecretsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayersInSegment(
@@ -920,24 +821,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayersInSegment", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayersInSegmentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
+        GetPlayersInSegment(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayersInSegmentResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayersInSegment(
+        PlayFabContext& context,
+        GetPlayersInSegmentRequest& request,
+        ProcessApiCallback<GetPlayersInSegmentResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayersInSegmentResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayersInSegmentResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayersInSegment", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayersInSegmentResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayerStatisticDefinitions(
@@ -947,24 +845,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerStatisticDefinitions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticDefinitionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticDefinitionsResult>(callback)), errorCallback, customData);
+        GetPlayerStatisticDefinitions(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayerStatisticDefinitions(
+        PlayFabContext& context,
+        GetPlayerStatisticDefinitionsRequest& request,
+        ProcessApiCallback<GetPlayerStatisticDefinitionsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerStatisticDefinitionsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticDefinitionsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayerStatisticDefinitions", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerStatisticDefinitionsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticDefinitionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayerStatisticVersions(
@@ -974,24 +869,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerStatisticVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
+        GetPlayerStatisticVersions(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayerStatisticVersionsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayerStatisticVersions(
+        PlayFabContext& context,
+        GetPlayerStatisticVersionsRequest& request,
+        ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerStatisticVersionsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticVersionsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayerStatisticVersions", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerStatisticVersionsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPlayerTags(
@@ -1001,24 +893,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
+        GetPlayerTags(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayerTagsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPlayerTags(
+        PlayFabContext& context,
+        GetPlayerTagsRequest& request,
+        ProcessApiCallback<GetPlayerTagsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerTagsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerTagsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPlayerTags", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerTagsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPolicy(
@@ -1028,24 +917,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPolicy", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPolicyResponse>(callback)), errorCallback, customData);
+        GetPolicy(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPolicyResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPolicy(
+        PlayFabContext& context,
+        GetPolicyRequest& request,
+        ProcessApiCallback<GetPolicyResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPolicyResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPolicyResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPolicy", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPolicyResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPolicyResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetPublisherData(
@@ -1055,24 +941,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
+        GetPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetPublisherDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetPublisherData(
+        PlayFabContext& context,
+        GetPublisherDataRequest& request,
+        ProcessApiCallback<GetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPublisherDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPublisherDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPublisherDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetRandomResultTables(
@@ -1082,24 +965,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
+        GetRandomResultTables(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetRandomResultTablesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetRandomResultTables(
+        PlayFabContext& context,
+        GetRandomResultTablesRequest& request,
+        ProcessApiCallback<GetRandomResultTablesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetRandomResultTablesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetRandomResultTablesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetRandomResultTables", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetRandomResultTablesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetServerBuildInfo(
@@ -1109,24 +989,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetServerBuildInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetServerBuildInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildInfoResult>(callback)), errorCallback, customData);
+        GetServerBuildInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetServerBuildInfoResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetServerBuildInfo(
+        PlayFabContext& context,
+        GetServerBuildInfoRequest& request,
+        ProcessApiCallback<GetServerBuildInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetServerBuildInfoResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetServerBuildInfoResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetServerBuildInfo", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetServerBuildInfoResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetServerBuildUploadUrl(
@@ -1136,24 +1013,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetServerBuildUploadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetServerBuildUploadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildUploadURLResult>(callback)), errorCallback, customData);
+        GetServerBuildUploadUrl(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetServerBuildUploadUrlResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetServerBuildUploadUrl(
+        PlayFabContext& context,
+        GetServerBuildUploadURLRequest& request,
+        ProcessApiCallback<GetServerBuildUploadURLResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetServerBuildUploadURLResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetServerBuildUploadURLResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetServerBuildUploadUrl", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetServerBuildUploadURLResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildUploadURLResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetStoreItems(
@@ -1163,24 +1037,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
+        GetStoreItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetStoreItemsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetStoreItems(
+        PlayFabContext& context,
+        GetStoreItemsRequest& request,
+        ProcessApiCallback<GetStoreItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetStoreItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetStoreItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetStoreItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetStoreItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetTaskInstances(
@@ -1190,24 +1061,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTaskInstances", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTaskInstancesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTaskInstancesResult>(callback)), errorCallback, customData);
+        GetTaskInstances(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetTaskInstancesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetTaskInstances(
+        PlayFabContext& context,
+        GetTaskInstancesRequest& request,
+        ProcessApiCallback<GetTaskInstancesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTaskInstancesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTaskInstancesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetTaskInstances", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTaskInstancesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTaskInstancesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetTasks(
@@ -1217,24 +1085,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTasks", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTasksResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTasksResult>(callback)), errorCallback, customData);
+        GetTasks(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetTasksResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetTasks(
+        PlayFabContext& context,
+        GetTasksRequest& request,
+        ProcessApiCallback<GetTasksResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTasksResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTasksResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetTasks", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTasksResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTasksResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetTitleData(
@@ -1244,24 +1109,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        GetTitleData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetTitleDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetTitleData(
+        PlayFabContext& context,
+        GetTitleDataRequest& request,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetTitleData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetTitleInternalData(
@@ -1271,24 +1133,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        GetTitleInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetTitleInternalDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetTitleInternalData(
+        PlayFabContext& context,
+        GetTitleDataRequest& request,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetTitleInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserAccountInfo(
@@ -1298,24 +1157,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserAccountInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LookupUserAccountInfoResult>(callback)), errorCallback, customData);
+        GetUserAccountInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserAccountInfoResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserAccountInfo(
+        PlayFabContext& context,
+        LookupUserAccountInfoRequest& request,
+        ProcessApiCallback<LookupUserAccountInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LookupUserAccountInfoResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LookupUserAccountInfoResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserAccountInfo", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<LookupUserAccountInfoResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LookupUserAccountInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserBans(
@@ -1325,24 +1181,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
+        GetUserBans(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserBansResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserBans(
+        PlayFabContext& context,
+        GetUserBansRequest& request,
+        ProcessApiCallback<GetUserBansResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserBansResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserBansResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserBans", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserBansResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserData(
@@ -1352,24 +1205,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserInternalData(
@@ -1379,24 +1229,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserInternalDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserInternalData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserInventory(
@@ -1406,24 +1253,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
+        GetUserInventory(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserInventoryResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserInventory(
+        PlayFabContext& context,
+        GetUserInventoryRequest& request,
+        ProcessApiCallback<GetUserInventoryResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserInventoryResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserInventoryResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserInventory", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserInventoryResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserPublisherData(
@@ -1433,24 +1277,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserPublisherDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserPublisherData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserPublisherInternalData(
@@ -1460,24 +1301,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserPublisherInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserPublisherInternalDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserPublisherInternalData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserPublisherInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserPublisherReadOnlyData(
@@ -1487,24 +1325,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserPublisherReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserPublisherReadOnlyData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserPublisherReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GetUserReadOnlyData(
@@ -1514,24 +1349,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGetUserReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GetUserReadOnlyData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GetUserReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::GrantItemsToUsers(
@@ -1541,24 +1373,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GrantItemsToUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
+        GrantItemsToUsers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnGrantItemsToUsersResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::GrantItemsToUsers(
+        PlayFabContext& context,
+        GrantItemsToUsersRequest& request,
+        ProcessApiCallback<GrantItemsToUsersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GrantItemsToUsersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GrantItemsToUsersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/GrantItemsToUsers", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GrantItemsToUsersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
@@ -1568,24 +1397,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/IncrementLimitedEditionItemAvailability", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnIncrementLimitedEditionItemAvailabilityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
+        IncrementLimitedEditionItemAvailability(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
+        PlayFabContext& context,
+        IncrementLimitedEditionItemAvailabilityRequest& request,
+        ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        IncrementLimitedEditionItemAvailabilityResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/IncrementLimitedEditionItemAvailability", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<IncrementLimitedEditionItemAvailabilityResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::IncrementPlayerStatisticVersion(
@@ -1595,24 +1421,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/IncrementPlayerStatisticVersion", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnIncrementPlayerStatisticVersionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementPlayerStatisticVersionResult>(callback)), errorCallback, customData);
+        IncrementPlayerStatisticVersion(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::IncrementPlayerStatisticVersion(
+        PlayFabContext& context,
+        IncrementPlayerStatisticVersionRequest& request,
+        ProcessApiCallback<IncrementPlayerStatisticVersionResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        IncrementPlayerStatisticVersionResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<IncrementPlayerStatisticVersionResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/IncrementPlayerStatisticVersion", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<IncrementPlayerStatisticVersionResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementPlayerStatisticVersionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ListServerBuilds(
@@ -1622,24 +1445,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ListServerBuilds", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnListServerBuildsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListBuildsResult>(callback)), errorCallback, customData);
+        ListServerBuilds(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnListServerBuildsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ListServerBuilds(
+        PlayFabContext& context,
+        ListBuildsRequest& request,
+        ProcessApiCallback<ListBuildsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListBuildsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListBuildsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ListServerBuilds", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ListBuildsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListBuildsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ListVirtualCurrencyTypes(
@@ -1649,24 +1469,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ListVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnListVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListVirtualCurrencyTypesResult>(callback)), errorCallback, customData);
+        ListVirtualCurrencyTypes(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnListVirtualCurrencyTypesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ListVirtualCurrencyTypes(
+        PlayFabContext& context,
+        ListVirtualCurrencyTypesRequest& request,
+        ProcessApiCallback<ListVirtualCurrencyTypesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListVirtualCurrencyTypesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListVirtualCurrencyTypesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ListVirtualCurrencyTypes", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ListVirtualCurrencyTypesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListVirtualCurrencyTypesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ModifyMatchmakerGameModes(
@@ -1676,24 +1493,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ModifyMatchmakerGameModes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyMatchmakerGameModesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyMatchmakerGameModesResult>(callback)), errorCallback, customData);
+        ModifyMatchmakerGameModes(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnModifyMatchmakerGameModesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ModifyMatchmakerGameModes(
+        PlayFabContext& context,
+        ModifyMatchmakerGameModesRequest& request,
+        ProcessApiCallback<ModifyMatchmakerGameModesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyMatchmakerGameModesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyMatchmakerGameModesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ModifyMatchmakerGameModes", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyMatchmakerGameModesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyMatchmakerGameModesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ModifyServerBuild(
@@ -1703,24 +1517,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ModifyServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyServerBuildResult>(callback)), errorCallback, customData);
+        ModifyServerBuild(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnModifyServerBuildResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ModifyServerBuild(
+        PlayFabContext& context,
+        ModifyServerBuildRequest& request,
+        ProcessApiCallback<ModifyServerBuildResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyServerBuildResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyServerBuildResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ModifyServerBuild", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyServerBuildResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyServerBuildResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RefundPurchase(
@@ -1730,27 +1541,35 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RefundPurchase", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRefundPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefundPurchaseResponse>(callback)), errorCallback, customData);
+        RefundPurchase(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRefundPurchaseResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RefundPurchase(
+        PlayFabContext& context,
+        RefundPurchaseRequest& request,
+        ProcessApiCallback<RefundPurchaseResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RefundPurchaseResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RefundPurchaseResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RefundPurchase", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RefundPurchaseResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefundPurchaseResponse>(callback)), errorCallback, customData);
+    }
+
+    void PlayFabAdminAPI::RemovePlayerTag(
+        RemovePlayerTagRequest& request,
+        ProcessApiCallback<RemovePlayerTagResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        RemovePlayerTag(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RemovePlayerTag(
+        PlayFabContext& context,
         RemovePlayerTagRequest& request,
         ProcessApiCallback<RemovePlayerTagResult> callback,
         ErrorCallback errorCallback,
@@ -1758,26 +1577,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RemovePlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemovePlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RemovePlayerTag", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RemovePlayerTagResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRemovePlayerTagResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RemoveServerBuild(
+        RemoveServerBuildRequest& request,
+        ProcessApiCallback<RemoveServerBuildResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemovePlayerTagResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemovePlayerTagResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemoveServerBuild(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RemoveServerBuild(
+        PlayFabContext& context,
         RemoveServerBuildRequest& request,
         ProcessApiCallback<RemoveServerBuildResult> callback,
         ErrorCallback errorCallback,
@@ -1785,26 +1601,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RemoveServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveServerBuildResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RemoveServerBuild", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RemoveServerBuildResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveServerBuildResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRemoveServerBuildResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RemoveVirtualCurrencyTypes(
+        RemoveVirtualCurrencyTypesRequest& request,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemoveServerBuildResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemoveServerBuildResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemoveVirtualCurrencyTypes(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RemoveVirtualCurrencyTypes(
+        PlayFabContext& context,
         RemoveVirtualCurrencyTypesRequest& request,
         ProcessApiCallback<BlankResult> callback,
         ErrorCallback errorCallback,
@@ -1812,26 +1625,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RemoveVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RemoveVirtualCurrencyTypes", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<BlankResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ResetCharacterStatistics(
+        ResetCharacterStatisticsRequest& request,
+        ProcessApiCallback<ResetCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        BlankResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<BlankResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ResetCharacterStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ResetCharacterStatistics(
+        PlayFabContext& context,
         ResetCharacterStatisticsRequest& request,
         ProcessApiCallback<ResetCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -1839,26 +1649,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResetCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetCharacterStatisticsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ResetCharacterStatistics", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ResetCharacterStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnResetCharacterStatisticsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ResetPassword(
+        ResetPasswordRequest& request,
+        ProcessApiCallback<ResetPasswordResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ResetCharacterStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ResetCharacterStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ResetPassword(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ResetPassword(
+        PlayFabContext& context,
         ResetPasswordRequest& request,
         ProcessApiCallback<ResetPasswordResult> callback,
         ErrorCallback errorCallback,
@@ -1866,26 +1673,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResetPassword", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetPasswordResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetPasswordResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ResetPassword", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ResetPasswordResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetPasswordResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnResetPasswordResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ResetUserStatistics(
+        ResetUserStatisticsRequest& request,
+        ProcessApiCallback<ResetUserStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ResetPasswordResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ResetPasswordResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ResetUserStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ResetUserStatistics(
+        PlayFabContext& context,
         ResetUserStatisticsRequest& request,
         ProcessApiCallback<ResetUserStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -1893,26 +1697,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResetUserStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetUserStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetUserStatisticsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ResetUserStatistics", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ResetUserStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetUserStatisticsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnResetUserStatisticsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::ResolvePurchaseDispute(
+        ResolvePurchaseDisputeRequest& request,
+        ProcessApiCallback<ResolvePurchaseDisputeResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ResetUserStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ResetUserStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ResolvePurchaseDispute(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::ResolvePurchaseDispute(
+        PlayFabContext& context,
         ResolvePurchaseDisputeRequest& request,
         ProcessApiCallback<ResolvePurchaseDisputeResponse> callback,
         ErrorCallback errorCallback,
@@ -1920,26 +1721,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResolvePurchaseDispute", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResolvePurchaseDisputeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResolvePurchaseDisputeResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/ResolvePurchaseDispute", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ResolvePurchaseDisputeResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResolvePurchaseDisputeResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnResolvePurchaseDisputeResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RevokeAllBansForUser(
+        RevokeAllBansForUserRequest& request,
+        ProcessApiCallback<RevokeAllBansForUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ResolvePurchaseDisputeResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ResolvePurchaseDisputeResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeAllBansForUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RevokeAllBansForUser(
+        PlayFabContext& context,
         RevokeAllBansForUserRequest& request,
         ProcessApiCallback<RevokeAllBansForUserResult> callback,
         ErrorCallback errorCallback,
@@ -1947,26 +1745,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeAllBansForUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeAllBansForUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RevokeAllBansForUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeAllBansForUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRevokeAllBansForUserResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RevokeBans(
+        RevokeBansRequest& request,
+        ProcessApiCallback<RevokeBansResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeAllBansForUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeAllBansForUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeBans(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RevokeBans(
+        PlayFabContext& context,
         RevokeBansRequest& request,
         ProcessApiCallback<RevokeBansResult> callback,
         ErrorCallback errorCallback,
@@ -1974,26 +1769,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RevokeBans", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeBansResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRevokeBansResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RevokeInventoryItem(
+        RevokeInventoryItemRequest& request,
+        ProcessApiCallback<RevokeInventoryResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeBansResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeBansResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeInventoryItem(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RevokeInventoryItem(
+        PlayFabContext& context,
         RevokeInventoryItemRequest& request,
         ProcessApiCallback<RevokeInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -2001,26 +1793,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeInventoryItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RevokeInventoryItem", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeInventoryResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRevokeInventoryItemResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RevokeInventoryItems(
+        RevokeInventoryItemsRequest& request,
+        ProcessApiCallback<RevokeInventoryItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeInventoryResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeInventoryResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeInventoryItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RevokeInventoryItems(
+        PlayFabContext& context,
         RevokeInventoryItemsRequest& request,
         ProcessApiCallback<RevokeInventoryItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2028,26 +1817,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeInventoryItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RevokeInventoryItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeInventoryItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRevokeInventoryItemsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::RunTask(
+        RunTaskRequest& request,
+        ProcessApiCallback<RunTaskResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeInventoryItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeInventoryItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RunTask(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::RunTask(
+        PlayFabContext& context,
         RunTaskRequest& request,
         ProcessApiCallback<RunTaskResult> callback,
         ErrorCallback errorCallback,
@@ -2055,26 +1841,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RunTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRunTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RunTaskResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/RunTask", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RunTaskResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RunTaskResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnRunTaskResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SendAccountRecoveryEmail(
+        SendAccountRecoveryEmailRequest& request,
+        ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RunTaskResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RunTaskResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SendAccountRecoveryEmail(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SendAccountRecoveryEmail(
+        PlayFabContext& context,
         SendAccountRecoveryEmailRequest& request,
         ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
         ErrorCallback errorCallback,
@@ -2082,26 +1865,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SendAccountRecoveryEmail", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SendAccountRecoveryEmail", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SendAccountRecoveryEmailResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSendAccountRecoveryEmailResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetCatalogItems(
+        UpdateCatalogItemsRequest& request,
+        ProcessApiCallback<UpdateCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SendAccountRecoveryEmailResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SendAccountRecoveryEmailResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetCatalogItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetCatalogItems(
+        PlayFabContext& context,
         UpdateCatalogItemsRequest& request,
         ProcessApiCallback<UpdateCatalogItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2109,26 +1889,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetCatalogItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateCatalogItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetCatalogItemsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetPlayerSecret(
+        SetPlayerSecretRequest& request,
+        ProcessApiCallback<SetPlayerSecretResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCatalogItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCatalogItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetPlayerSecret(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetPlayerSecret(
+        PlayFabContext& context,
         SetPlayerSecretRequest& request,
         ProcessApiCallback<SetPlayerSecretResult> callback,
         ErrorCallback errorCallback,
@@ -2136,26 +1913,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetPlayerSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetPlayerSecret", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetPlayerSecretResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetPlayerSecretResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetPublishedRevision(
+        SetPublishedRevisionRequest& request,
+        ProcessApiCallback<SetPublishedRevisionResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetPlayerSecretResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetPlayerSecretResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetPublishedRevision(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetPublishedRevision(
+        PlayFabContext& context,
         SetPublishedRevisionRequest& request,
         ProcessApiCallback<SetPublishedRevisionResult> callback,
         ErrorCallback errorCallback,
@@ -2163,26 +1937,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetPublishedRevision", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublishedRevisionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublishedRevisionResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetPublishedRevision", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetPublishedRevisionResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublishedRevisionResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetPublishedRevisionResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetPublisherData(
+        SetPublisherDataRequest& request,
+        ProcessApiCallback<SetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetPublishedRevisionResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetPublishedRevisionResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetPublisherData(
+        PlayFabContext& context,
         SetPublisherDataRequest& request,
         ProcessApiCallback<SetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -2190,26 +1961,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetPublisherDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetPublisherDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetStoreItems(
+        UpdateStoreItemsRequest& request,
+        ProcessApiCallback<UpdateStoreItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetPublisherDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetPublisherDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetStoreItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetStoreItems(
+        PlayFabContext& context,
         UpdateStoreItemsRequest& request,
         ProcessApiCallback<UpdateStoreItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2217,26 +1985,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetStoreItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateStoreItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetStoreItemsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetTitleData(
+        SetTitleDataRequest& request,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateStoreItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateStoreItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetTitleData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetTitleData(
+        PlayFabContext& context,
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2244,26 +2009,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetTitleData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetTitleDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetTitleInternalData(
+        SetTitleDataRequest& request,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetTitleInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetTitleInternalData(
+        PlayFabContext& context,
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2271,26 +2033,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetTitleInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetTitleInternalDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SetupPushNotification(
+        SetupPushNotificationRequest& request,
+        ProcessApiCallback<SetupPushNotificationResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetupPushNotification(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SetupPushNotification(
+        PlayFabContext& context,
         SetupPushNotificationRequest& request,
         ProcessApiCallback<SetupPushNotificationResult> callback,
         ErrorCallback errorCallback,
@@ -2298,26 +2057,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetupPushNotification", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetupPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetupPushNotificationResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SetupPushNotification", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetupPushNotificationResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetupPushNotificationResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSetupPushNotificationResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::SubtractUserVirtualCurrency(
+        SubtractUserVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetupPushNotificationResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetupPushNotificationResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SubtractUserVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::SubtractUserVirtualCurrency(
+        PlayFabContext& context,
         SubtractUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2325,26 +2081,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SubtractUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/SubtractUserVirtualCurrency", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyUserVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateBans(
+        UpdateBansRequest& request,
+        ProcessApiCallback<UpdateBansResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyUserVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateBans(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateBans(
+        PlayFabContext& context,
         UpdateBansRequest& request,
         ProcessApiCallback<UpdateBansResult> callback,
         ErrorCallback errorCallback,
@@ -2352,26 +2105,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateBans", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateBansResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateBansResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateCatalogItems(
+        UpdateCatalogItemsRequest& request,
+        ProcessApiCallback<UpdateCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateBansResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateBansResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCatalogItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateCatalogItems(
+        PlayFabContext& context,
         UpdateCatalogItemsRequest& request,
         ProcessApiCallback<UpdateCatalogItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2379,26 +2129,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateCatalogItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateCatalogItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateCatalogItemsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateCloudScript(
+        UpdateCloudScriptRequest& request,
+        ProcessApiCallback<UpdateCloudScriptResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCatalogItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCatalogItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCloudScript(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateCloudScript(
+        PlayFabContext& context,
         UpdateCloudScriptRequest& request,
         ProcessApiCallback<UpdateCloudScriptResult> callback,
         ErrorCallback errorCallback,
@@ -2406,26 +2153,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateCloudScript", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCloudScriptResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateCloudScript", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateCloudScriptResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCloudScriptResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateCloudScriptResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdatePlayerSharedSecret(
+        UpdatePlayerSharedSecretRequest& request,
+        ProcessApiCallback<UpdatePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCloudScriptResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCloudScriptResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdatePlayerSharedSecret(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdatePlayerSharedSecret(
+        PlayFabContext& context,
         UpdatePlayerSharedSecretRequest& request,
         ProcessApiCallback<UpdatePlayerSharedSecretResult> callback,
         ErrorCallback errorCallback,
@@ -2433,26 +2177,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdatePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerSharedSecretResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdatePlayerSharedSecret", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdatePlayerSharedSecretResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerSharedSecretResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdatePlayerSharedSecretResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdatePlayerStatisticDefinition(
+        UpdatePlayerStatisticDefinitionRequest& request,
+        ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdatePlayerSharedSecretResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdatePlayerSharedSecretResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdatePlayerStatisticDefinition(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdatePlayerStatisticDefinition(
+        PlayFabContext& context,
         UpdatePlayerStatisticDefinitionRequest& request,
         ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> callback,
         ErrorCallback errorCallback,
@@ -2460,26 +2201,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdatePlayerStatisticDefinition", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerStatisticDefinitionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdatePlayerStatisticDefinition", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdatePlayerStatisticDefinitionResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdatePolicy(
+        UpdatePolicyRequest& request,
+        ProcessApiCallback<UpdatePolicyResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdatePlayerStatisticDefinitionResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdatePolicy(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdatePolicy(
+        PlayFabContext& context,
         UpdatePolicyRequest& request,
         ProcessApiCallback<UpdatePolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -2487,26 +2225,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdatePolicy", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePolicyResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdatePolicy", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdatePolicyResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePolicyResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdatePolicyResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateRandomResultTables(
+        UpdateRandomResultTablesRequest& request,
+        ProcessApiCallback<UpdateRandomResultTablesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdatePolicyResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdatePolicyResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateRandomResultTables(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateRandomResultTables(
+        PlayFabContext& context,
         UpdateRandomResultTablesRequest& request,
         ProcessApiCallback<UpdateRandomResultTablesResult> callback,
         ErrorCallback errorCallback,
@@ -2514,26 +2249,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateRandomResultTablesResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateRandomResultTables", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateRandomResultTablesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateRandomResultTablesResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateRandomResultTablesResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateStoreItems(
+        UpdateStoreItemsRequest& request,
+        ProcessApiCallback<UpdateStoreItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateRandomResultTablesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateRandomResultTablesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateStoreItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateStoreItems(
+        PlayFabContext& context,
         UpdateStoreItemsRequest& request,
         ProcessApiCallback<UpdateStoreItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2541,26 +2273,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateStoreItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateStoreItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateStoreItemsResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateTask(
+        UpdateTaskRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateStoreItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateStoreItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateTask(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateTask(
+        PlayFabContext& context,
         UpdateTaskRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2568,26 +2297,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateTask", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateTaskResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateUserData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateUserData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2595,26 +2321,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateUserData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateUserInternalData(
+        UpdateUserInternalDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateUserInternalData(
+        PlayFabContext& context,
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2622,26 +2345,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateUserInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserInternalDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateUserPublisherData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateUserPublisherData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2649,26 +2369,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateUserPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserPublisherDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateUserPublisherInternalData(
+        UpdateUserInternalDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserPublisherInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateUserPublisherInternalData(
+        PlayFabContext& context,
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2676,26 +2393,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateUserPublisherInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserPublisherReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2703,26 +2417,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateUserPublisherReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateUserReadOnlyData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateUserReadOnlyData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2730,26 +2441,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateUserReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabAdminAPI::UpdateUserTitleDisplayName(
+        UpdateUserTitleDisplayNameRequest& request,
+        ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserTitleDisplayName(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabAdminAPI::UpdateUserTitleDisplayName(
+        PlayFabContext& context,
         UpdateUserTitleDisplayNameRequest& request,
         ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
         ErrorCallback errorCallback,
@@ -2757,24 +2465,11 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserTitleDisplayName", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserTitleDisplayNameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Admin/UpdateUserTitleDisplayName", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserTitleDisplayNameResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult(CallRequestContainer& request)
-    {
-        UpdateUserTitleDisplayNameResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserTitleDisplayNameResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
-    }
 }
 
 #endif
@@ -29,24 +29,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AcceptTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAcceptTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AcceptTradeResponse>(callback)), errorCallback, customData);
+        AcceptTrade(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAcceptTradeResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AcceptTrade(
+        PlayFabContext& context,
+        AcceptTradeRequest& request,
+        ProcessApiCallback<AcceptTradeResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AcceptTradeResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AcceptTradeResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AcceptTrade", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AcceptTradeResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AcceptTradeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AddFriend(
@@ -56,24 +53,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddFriend", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddFriendResult>(callback)), errorCallback, customData);
+        AddFriend(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAddFriendResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AddFriend(
+        PlayFabContext& context,
+        AddFriendRequest& request,
+        ProcessApiCallback<AddFriendResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddFriendResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddFriendResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AddFriend", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AddFriendResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddFriendResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AddGenericID(
@@ -83,24 +77,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddGenericID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddGenericIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddGenericIDResult>(callback)), errorCallback, customData);
+        AddGenericID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAddGenericIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AddGenericID(
+        PlayFabContext& context,
+        AddGenericIDRequest& request,
+        ProcessApiCallback<AddGenericIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddGenericIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddGenericIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AddGenericID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AddGenericIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddGenericIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AddOrUpdateContactEmail(
@@ -110,24 +101,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddOrUpdateContactEmail", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddOrUpdateContactEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddOrUpdateContactEmailResult>(callback)), errorCallback, customData);
+        AddOrUpdateContactEmail(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAddOrUpdateContactEmailResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AddOrUpdateContactEmail(
+        PlayFabContext& context,
+        AddOrUpdateContactEmailRequest& request,
+        ProcessApiCallback<AddOrUpdateContactEmailResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddOrUpdateContactEmailResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddOrUpdateContactEmailResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AddOrUpdateContactEmail", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AddOrUpdateContactEmailResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddOrUpdateContactEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AddSharedGroupMembers(
@@ -137,24 +125,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddSharedGroupMembers", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
+        AddSharedGroupMembers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAddSharedGroupMembersResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AddSharedGroupMembers(
+        PlayFabContext& context,
+        AddSharedGroupMembersRequest& request,
+        ProcessApiCallback<AddSharedGroupMembersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddSharedGroupMembersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddSharedGroupMembersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AddSharedGroupMembers", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AddSharedGroupMembersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AddUsernamePassword(
@@ -164,24 +149,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddUsernamePassword", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddUsernamePasswordResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddUsernamePasswordResult>(callback)), errorCallback, customData);
+        AddUsernamePassword(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAddUsernamePasswordResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AddUsernamePassword(
+        PlayFabContext& context,
+        AddUsernamePasswordRequest& request,
+        ProcessApiCallback<AddUsernamePasswordResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddUsernamePasswordResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddUsernamePasswordResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AddUsernamePassword", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AddUsernamePasswordResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddUsernamePasswordResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AddUserVirtualCurrency(
@@ -191,24 +173,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddUserVirtualCurrency", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        AddUserVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAddUserVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AddUserVirtualCurrency(
+        PlayFabContext& context,
+        AddUserVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyUserVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AddUserVirtualCurrency", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ModifyUserVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AndroidDevicePushNotificationRegistration(
@@ -218,24 +197,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AndroidDevicePushNotificationRegistration", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAndroidDevicePushNotificationRegistrationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult>(callback)), errorCallback, customData);
+        AndroidDevicePushNotificationRegistration(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AndroidDevicePushNotificationRegistration(
+        PlayFabContext& context,
+        AndroidDevicePushNotificationRegistrationRequest& request,
+        ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AndroidDevicePushNotificationRegistrationResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AndroidDevicePushNotificationRegistration", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AndroidDevicePushNotificationRegistrationResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::AttributeInstall(
@@ -245,25 +221,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AttributeInstall", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAttributeInstallResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AttributeInstallResult>(callback)), errorCallback, customData);
+        AttributeInstall(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnAttributeInstallResult(CallRequestContainer& request)
+    void PlayFabClientAPI::AttributeInstall(
+        PlayFabContext& context,
+        AttributeInstallRequest& request,
+        ProcessApiCallback<AttributeInstallResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AttributeInstallResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        PlayFabSettings::advertisingIdType += "_Successful";
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AttributeInstallResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/AttributeInstall", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<AttributeInstallResult, OnAttributeInstallResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AttributeInstallResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::CancelTrade(
@@ -273,24 +245,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/CancelTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnCancelTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CancelTradeResponse>(callback)), errorCallback, customData);
+        CancelTrade(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnCancelTradeResult(CallRequestContainer& request)
+    void PlayFabClientAPI::CancelTrade(
+        PlayFabContext& context,
+        CancelTradeRequest& request,
+        ProcessApiCallback<CancelTradeResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CancelTradeResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CancelTradeResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/CancelTrade", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<CancelTradeResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CancelTradeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::ConfirmPurchase(
@@ -300,24 +269,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ConfirmPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnConfirmPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConfirmPurchaseResult>(callback)), errorCallback, customData);
+        ConfirmPurchase(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnConfirmPurchaseResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ConfirmPurchase(
+        PlayFabContext& context,
+        ConfirmPurchaseRequest& request,
+        ProcessApiCallback<ConfirmPurchaseResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ConfirmPurchaseResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ConfirmPurchaseResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ConfirmPurchase", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ConfirmPurchaseResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConfirmPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::ConsumeItem(
@@ -327,24 +293,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ConsumeItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnConsumeItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
+        ConsumeItem(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnConsumeItemResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ConsumeItem(
+        PlayFabContext& context,
+        ConsumeItemRequest& request,
+        ProcessApiCallback<ConsumeItemResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ConsumeItemResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ConsumeItemResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ConsumeItem", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ConsumeItemResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::CreateSharedGroup(
@@ -354,24 +317,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/CreateSharedGroup", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnCreateSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
+        CreateSharedGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnCreateSharedGroupResult(CallRequestContainer& request)
+    void PlayFabClientAPI::CreateSharedGroup(
+        PlayFabContext& context,
+        CreateSharedGroupRequest& request,
+        ProcessApiCallback<CreateSharedGroupResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreateSharedGroupResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreateSharedGroupResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/CreateSharedGroup", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<CreateSharedGroupResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::ExecuteCloudScript(
@@ -381,24 +341,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ExecuteCloudScript", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnExecuteCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
+        ExecuteCloudScript(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnExecuteCloudScriptResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ExecuteCloudScript(
+        PlayFabContext& context,
+        ExecuteCloudScriptRequest& request,
+        ProcessApiCallback<ExecuteCloudScriptResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ExecuteCloudScriptResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ExecuteCloudScriptResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ExecuteCloudScript", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ExecuteCloudScriptResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetAccountInfo(
@@ -408,24 +365,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetAccountInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAccountInfoResult>(callback)), errorCallback, customData);
+        GetAccountInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetAccountInfoResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetAccountInfo(
+        PlayFabContext& context,
+        GetAccountInfoRequest& request,
+        ProcessApiCallback<GetAccountInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetAccountInfoResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetAccountInfoResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetAccountInfo", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetAccountInfoResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAccountInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetAllUsersCharacters(
@@ -435,24 +389,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetAllUsersCharacters", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetAllUsersCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
+        GetAllUsersCharacters(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetAllUsersCharactersResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetAllUsersCharacters(
+        PlayFabContext& context,
+        ListUsersCharactersRequest& request,
+        ProcessApiCallback<ListUsersCharactersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListUsersCharactersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListUsersCharactersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetAllUsersCharacters", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ListUsersCharactersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetCatalogItems(
@@ -462,24 +413,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCatalogItems", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
+        GetCatalogItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetCatalogItemsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetCatalogItems(
+        PlayFabContext& context,
+        GetCatalogItemsRequest& request,
+        ProcessApiCallback<GetCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCatalogItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCatalogItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetCatalogItems", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetCatalogItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetCharacterData(
@@ -489,24 +437,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        GetCharacterData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetCharacterDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetCharacterData(
+        PlayFabContext& context,
+        GetCharacterDataRequest& request,
+        ProcessApiCallback<GetCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetCharacterData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetCharacterInventory(
@@ -516,24 +461,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterInventory", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
+        GetCharacterInventory(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetCharacterInventoryResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetCharacterInventory(
+        PlayFabContext& context,
+        GetCharacterInventoryRequest& request,
+        ProcessApiCallback<GetCharacterInventoryResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterInventoryResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterInventoryResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetCharacterInventory", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetCharacterInventoryResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetCharacterLeaderboard(
@@ -543,24 +485,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
+        GetCharacterLeaderboard(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetCharacterLeaderboardResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetCharacterLeaderboard(
+        PlayFabContext& context,
+        GetCharacterLeaderboardRequest& request,
+        ProcessApiCallback<GetCharacterLeaderboardResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterLeaderboardResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterLeaderboardResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetCharacterLeaderboard", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetCharacterLeaderboardResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetCharacterReadOnlyData(
@@ -570,24 +509,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        GetCharacterReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetCharacterReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetCharacterReadOnlyData(
+        PlayFabContext& context,
+        GetCharacterDataRequest& request,
+        ProcessApiCallback<GetCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetCharacterReadOnlyData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetCharacterStatistics(
@@ -597,24 +533,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
+        GetCharacterStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetCharacterStatisticsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetCharacterStatistics(
+        PlayFabContext& context,
+        GetCharacterStatisticsRequest& request,
+        ProcessApiCallback<GetCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetCharacterStatistics", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetCharacterStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetContentDownloadUrl(
@@ -624,24 +557,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetContentDownloadUrl", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetContentDownloadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
+        GetContentDownloadUrl(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetContentDownloadUrlResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetContentDownloadUrl(
+        PlayFabContext& context,
+        GetContentDownloadUrlRequest& request,
+        ProcessApiCallback<GetContentDownloadUrlResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetContentDownloadUrlResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetContentDownloadUrlResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetContentDownloadUrl", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetContentDownloadUrlResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetCurrentGames(
@@ -651,24 +581,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCurrentGames", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCurrentGamesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CurrentGamesResult>(callback)), errorCallback, customData);
+        GetCurrentGames(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetCurrentGamesResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetCurrentGames(
+        PlayFabContext& context,
+        CurrentGamesRequest& request,
+        ProcessApiCallback<CurrentGamesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CurrentGamesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CurrentGamesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetCurrentGames", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<CurrentGamesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CurrentGamesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetFriendLeaderboard(
@@ -678,24 +605,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetFriendLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        GetFriendLeaderboard(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetFriendLeaderboardResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetFriendLeaderboard(
+        PlayFabContext& context,
+        GetFriendLeaderboardRequest& request,
+        ProcessApiCallback<GetLeaderboardResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetFriendLeaderboard", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetLeaderboardResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
@@ -705,24 +629,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetFriendLeaderboardAroundPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendLeaderboardAroundPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
+        GetFriendLeaderboardAroundPlayer(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
+        PlayFabContext& context,
+        GetFriendLeaderboardAroundPlayerRequest& request,
+        ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetFriendLeaderboardAroundPlayerResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetFriendLeaderboardAroundPlayer", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetFriendLeaderboardAroundPlayerResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetFriendsList(
@@ -732,24 +653,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetFriendsList", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendsListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
+        GetFriendsList(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetFriendsListResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetFriendsList(
+        PlayFabContext& context,
+        GetFriendsListRequest& request,
+        ProcessApiCallback<GetFriendsListResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetFriendsListResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetFriendsListResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetFriendsList", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetFriendsListResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetGameServerRegions(
@@ -759,24 +677,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetGameServerRegions", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetGameServerRegionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GameServerRegionsResult>(callback)), errorCallback, customData);
+        GetGameServerRegions(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetGameServerRegionsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetGameServerRegions(
+        PlayFabContext& context,
+        GameServerRegionsRequest& request,
+        ProcessApiCallback<GameServerRegionsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GameServerRegionsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GameServerRegionsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetGameServerRegions", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GameServerRegionsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GameServerRegionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetLeaderboard(
@@ -786,24 +701,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        GetLeaderboard(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetLeaderboardResult(CallRequestContainer& request)
-    {
-        GetLeaderboardResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+    void PlayFabClientAPI::GetLeaderboard(
+        PlayFabContext& context,
+        GetLeaderboardRequest& request,
+        ProcessApiCallback<GetLeaderboardResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetLeaderboard", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetLeaderboardResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetLeaderboardAroundCharacter(
@@ -813,24 +725,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboardAroundCharacter", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardAroundCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
+        GetLeaderboardAroundCharacter(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetLeaderboardAroundCharacterResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetLeaderboardAroundCharacter(
+        PlayFabContext& context,
+        GetLeaderboardAroundCharacterRequest& request,
+        ProcessApiCallback<GetLeaderboardAroundCharacterResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardAroundCharacterResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardAroundCharacterResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetLeaderboardAroundCharacter", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetLeaderboardAroundCharacterResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetLeaderboardAroundPlayer(
@@ -840,24 +749,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboardAroundPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardAroundPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
+        GetLeaderboardAroundPlayer(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetLeaderboardAroundPlayerResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetLeaderboardAroundPlayer(
+        PlayFabContext& context,
+        GetLeaderboardAroundPlayerRequest& request,
+        ProcessApiCallback<GetLeaderboardAroundPlayerResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardAroundPlayerResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardAroundPlayerResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetLeaderboardAroundPlayer", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetLeaderboardAroundPlayerResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetLeaderboardForUserCharacters(
@@ -867,24 +773,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboardForUserCharacters", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardForUserCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
+        GetLeaderboardForUserCharacters(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetLeaderboardForUserCharactersResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetLeaderboardForUserCharacters(
+        PlayFabContext& context,
+        GetLeaderboardForUsersCharactersRequest& request,
+        ProcessApiCallback<GetLeaderboardForUsersCharactersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardForUsersCharactersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardForUsersCharactersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetLeaderboardForUserCharacters", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetLeaderboardForUsersCharactersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPaymentToken(
@@ -894,24 +797,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPaymentToken", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPaymentTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPaymentTokenResult>(callback)), errorCallback, customData);
+        GetPaymentToken(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPaymentTokenResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPaymentToken(
+        PlayFabContext& context,
+        GetPaymentTokenRequest& request,
+        ProcessApiCallback<GetPaymentTokenResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPaymentTokenResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPaymentTokenResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPaymentToken", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPaymentTokenResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPaymentTokenResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPhotonAuthenticationToken(
@@ -921,24 +821,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPhotonAuthenticationToken", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPhotonAuthenticationTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPhotonAuthenticationTokenResult>(callback)), errorCallback, customData);
+        GetPhotonAuthenticationToken(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPhotonAuthenticationTokenResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPhotonAuthenticationToken(
+        PlayFabContext& context,
+        GetPhotonAuthenticationTokenRequest& request,
+        ProcessApiCallback<GetPhotonAuthenticationTokenResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPhotonAuthenticationTokenResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPhotonAuthenticationTokenResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPhotonAuthenticationToken", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPhotonAuthenticationTokenResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPhotonAuthenticationTokenResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayerCombinedInfo(
@@ -948,24 +845,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerCombinedInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerCombinedInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
+        GetPlayerCombinedInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayerCombinedInfoResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayerCombinedInfo(
+        PlayFabContext& context,
+        GetPlayerCombinedInfoRequest& request,
+        ProcessApiCallback<GetPlayerCombinedInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerCombinedInfoResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerCombinedInfoResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayerCombinedInfo", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayerCombinedInfoResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayerProfile(
@@ -975,24 +869,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerProfile", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
+        GetPlayerProfile(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayerProfileResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayerProfile(
+        PlayFabContext& context,
+        GetPlayerProfileRequest& request,
+        ProcessApiCallback<GetPlayerProfileResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerProfileResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerProfileResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayerProfile", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayerProfileResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayerSegments(
@@ -1002,24 +893,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerSegments", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
+        GetPlayerSegments(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayerSegmentsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayerSegments(
+        PlayFabContext& context,
+        GetPlayerSegmentsRequest& request,
+        ProcessApiCallback<GetPlayerSegmentsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerSegmentsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerSegmentsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayerSegments", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayerSegmentsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayerStatistics(
@@ -1029,24 +917,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
+        GetPlayerStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayerStatisticsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayerStatistics(
+        PlayFabContext& context,
+        GetPlayerStatisticsRequest& request,
+        ProcessApiCallback<GetPlayerStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayerStatistics", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayerStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayerStatisticVersions(
@@ -1056,24 +941,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerStatisticVersions", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
+        GetPlayerStatisticVersions(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayerStatisticVersionsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayerStatisticVersions(
+        PlayFabContext& context,
+        GetPlayerStatisticVersionsRequest& request,
+        ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerStatisticVersionsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticVersionsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayerStatisticVersions", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayerStatisticVersionsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayerTags(
@@ -1083,24 +965,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerTags", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
+        GetPlayerTags(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayerTagsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayerTags(
+        PlayFabContext& context,
+        GetPlayerTagsRequest& request,
+        ProcessApiCallback<GetPlayerTagsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerTagsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerTagsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayerTags", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayerTagsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayerTrades(
@@ -1110,24 +989,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerTrades", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerTradesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTradesResponse>(callback)), errorCallback, customData);
+        GetPlayerTrades(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayerTradesResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayerTrades(
+        PlayFabContext& context,
+        GetPlayerTradesRequest& request,
+        ProcessApiCallback<GetPlayerTradesResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerTradesResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerTradesResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayerTrades", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayerTradesResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTradesResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
@@ -1137,24 +1013,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromFacebookIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromFacebookIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
+        GetPlayFabIDsFromFacebookIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
+        PlayFabContext& context,
+        GetPlayFabIDsFromFacebookIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromFacebookIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayFabIDsFromFacebookIDs", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromFacebookIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
@@ -1164,24 +1037,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromGameCenterIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGameCenterIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult>(callback)), errorCallback, customData);
+        GetPlayFabIDsFromGameCenterIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
+        PlayFabContext& context,
+        GetPlayFabIDsFromGameCenterIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromGameCenterIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayFabIDsFromGameCenterIDs", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromGameCenterIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
@@ -1191,24 +1061,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromGenericIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGenericIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult>(callback)), errorCallback, customData);
+        GetPlayFabIDsFromGenericIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
+        PlayFabContext& context,
+        GetPlayFabIDsFromGenericIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromGenericIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayFabIDsFromGenericIDs", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromGenericIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
@@ -1218,24 +1085,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromGoogleIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGoogleIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult>(callback)), errorCallback, customData);
+        GetPlayFabIDsFromGoogleIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
+        PlayFabContext& context,
+        GetPlayFabIDsFromGoogleIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromGoogleIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayFabIDsFromGoogleIDs", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromGoogleIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
@@ -1245,24 +1109,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromKongregateIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromKongregateIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult>(callback)), errorCallback, customData);
+        GetPlayFabIDsFromKongregateIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
+        PlayFabContext& context,
+        GetPlayFabIDsFromKongregateIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromKongregateIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayFabIDsFromKongregateIDs", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromKongregateIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
@@ -1272,24 +1133,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromSteamIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromSteamIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
+        GetPlayFabIDsFromSteamIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
+        PlayFabContext& context,
+        GetPlayFabIDsFromSteamIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromSteamIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayFabIDsFromSteamIDs", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromSteamIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
@@ -1299,24 +1157,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromTwitchIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromTwitchIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult>(callback)), errorCallback, customData);
+        GetPlayFabIDsFromTwitchIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
+        PlayFabContext& context,
+        GetPlayFabIDsFromTwitchIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromTwitchIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPlayFabIDsFromTwitchIDs", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromTwitchIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPublisherData(
@@ -1326,24 +1181,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
+        GetPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPublisherDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPublisherData(
+        PlayFabContext& context,
+        GetPublisherDataRequest& request,
+        ProcessApiCallback<GetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPublisherDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPublisherDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPublisherData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPublisherDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetPurchase(
@@ -1353,24 +1205,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPurchaseResult>(callback)), errorCallback, customData);
+        GetPurchase(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetPurchaseResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetPurchase(
+        PlayFabContext& context,
+        GetPurchaseRequest& request,
+        ProcessApiCallback<GetPurchaseResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPurchaseResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPurchaseResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetPurchase", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetPurchaseResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetSharedGroupData(
@@ -1380,24 +1229,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetSharedGroupData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
+        GetSharedGroupData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetSharedGroupDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetSharedGroupData(
+        PlayFabContext& context,
+        GetSharedGroupDataRequest& request,
+        ProcessApiCallback<GetSharedGroupDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetSharedGroupDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetSharedGroupDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetSharedGroupData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetSharedGroupDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetStoreItems(
@@ -1407,24 +1253,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetStoreItems", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
+        GetStoreItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetStoreItemsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetStoreItems(
+        PlayFabContext& context,
+        GetStoreItemsRequest& request,
+        ProcessApiCallback<GetStoreItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetStoreItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetStoreItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetStoreItems", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetStoreItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetTime(
@@ -1434,24 +1277,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTime", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTimeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
+        GetTime(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetTimeResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetTime(
+        PlayFabContext& context,
+        GetTimeRequest& request,
+        ProcessApiCallback<GetTimeResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTimeResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTimeResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetTime", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetTimeResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetTitleData(
@@ -1461,24 +1301,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTitleData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        GetTitleData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetTitleDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetTitleData(
+        PlayFabContext& context,
+        GetTitleDataRequest& request,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetTitleData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetTitleNews(
@@ -1488,24 +1325,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTitleNews", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTitleNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
+        GetTitleNews(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetTitleNewsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetTitleNews(
+        PlayFabContext& context,
+        GetTitleNewsRequest& request,
+        ProcessApiCallback<GetTitleNewsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitleNewsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitleNewsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetTitleNews", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetTitleNewsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetTitlePublicKey(
@@ -1515,24 +1349,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTitlePublicKey", "", "", requestJson, OnGetTitlePublicKeyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitlePublicKeyResult>(callback)), errorCallback, customData);
+        GetTitlePublicKey(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetTitlePublicKeyResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetTitlePublicKey(
+        PlayFabContext& context,
+        GetTitlePublicKeyRequest& request,
+        ProcessApiCallback<GetTitlePublicKeyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitlePublicKeyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitlePublicKeyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetTitlePublicKey", "", "", std::move(requestJson), DispatchResult<GetTitlePublicKeyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitlePublicKeyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetTradeStatus(
@@ -1542,24 +1373,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTradeStatus", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTradeStatusResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTradeStatusResponse>(callback)), errorCallback, customData);
+        GetTradeStatus(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetTradeStatusResult(CallRequestContainer& request)
-    {
-        GetTradeStatusResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTradeStatusResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+    void PlayFabClientAPI::GetTradeStatus(
+        PlayFabContext& context,
+        GetTradeStatusRequest& request,
+        ProcessApiCallback<GetTradeStatusResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetTradeStatus", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetTradeStatusResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTradeStatusResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetUserData(
@@ -1569,24 +1397,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetUserDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetUserData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetUserData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetUserInventory(
@@ -1596,24 +1421,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserInventory", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
+        GetUserInventory(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetUserInventoryResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetUserInventory(
+        PlayFabContext& context,
+        GetUserInventoryRequest& request,
+        ProcessApiCallback<GetUserInventoryResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserInventoryResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserInventoryResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetUserInventory", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetUserInventoryResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetUserPublisherData(
@@ -1623,24 +1445,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetUserPublisherDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetUserPublisherData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetUserPublisherData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetUserPublisherReadOnlyData(
@@ -1650,24 +1469,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserPublisherReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserPublisherReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetUserPublisherReadOnlyData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetUserPublisherReadOnlyData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetUserReadOnlyData(
@@ -1677,24 +1493,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        GetUserReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetUserReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetUserReadOnlyData(
+        PlayFabContext& context,
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetUserReadOnlyData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GetWindowsHelloChallenge(
@@ -1704,24 +1517,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetWindowsHelloChallenge", "", "", requestJson, OnGetWindowsHelloChallengeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetWindowsHelloChallengeResponse>(callback)), errorCallback, customData);
+        GetWindowsHelloChallenge(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGetWindowsHelloChallengeResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GetWindowsHelloChallenge(
+        PlayFabContext& context,
+        GetWindowsHelloChallengeRequest& request,
+        ProcessApiCallback<GetWindowsHelloChallengeResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetWindowsHelloChallengeResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetWindowsHelloChallengeResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GetWindowsHelloChallenge", "", "", std::move(requestJson), DispatchResult<GetWindowsHelloChallengeResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetWindowsHelloChallengeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::GrantCharacterToUser(
@@ -1731,24 +1541,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GrantCharacterToUser", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGrantCharacterToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
+        GrantCharacterToUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnGrantCharacterToUserResult(CallRequestContainer& request)
+    void PlayFabClientAPI::GrantCharacterToUser(
+        PlayFabContext& context,
+        GrantCharacterToUserRequest& request,
+        ProcessApiCallback<GrantCharacterToUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GrantCharacterToUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GrantCharacterToUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/GrantCharacterToUser", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<GrantCharacterToUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkAndroidDeviceID(
@@ -1758,24 +1565,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkAndroidDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
+        LinkAndroidDeviceID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkAndroidDeviceIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkAndroidDeviceID(
+        PlayFabContext& context,
+        LinkAndroidDeviceIDRequest& request,
+        ProcessApiCallback<LinkAndroidDeviceIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkAndroidDeviceIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkAndroidDeviceIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkAndroidDeviceID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkAndroidDeviceIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkCustomID(
@@ -1785,24 +1589,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkCustomID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkCustomIDResult>(callback)), errorCallback, customData);
+        LinkCustomID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkCustomIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkCustomID(
+        PlayFabContext& context,
+        LinkCustomIDRequest& request,
+        ProcessApiCallback<LinkCustomIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkCustomIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkCustomIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkCustomID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkCustomIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkCustomIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkFacebookAccount(
@@ -1812,24 +1613,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkFacebookAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkFacebookAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkFacebookAccountResult>(callback)), errorCallback, customData);
+        LinkFacebookAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkFacebookAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkFacebookAccount(
+        PlayFabContext& context,
+        LinkFacebookAccountRequest& request,
+        ProcessApiCallback<LinkFacebookAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkFacebookAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkFacebookAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkFacebookAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkFacebookAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkFacebookAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkGameCenterAccount(
@@ -1839,24 +1637,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkGameCenterAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkGameCenterAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGameCenterAccountResult>(callback)), errorCallback, customData);
+        LinkGameCenterAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkGameCenterAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkGameCenterAccount(
+        PlayFabContext& context,
+        LinkGameCenterAccountRequest& request,
+        ProcessApiCallback<LinkGameCenterAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkGameCenterAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkGameCenterAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkGameCenterAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkGameCenterAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGameCenterAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkGoogleAccount(
@@ -1866,24 +1661,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkGoogleAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGoogleAccountResult>(callback)), errorCallback, customData);
+        LinkGoogleAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkGoogleAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkGoogleAccount(
+        PlayFabContext& context,
+        LinkGoogleAccountRequest& request,
+        ProcessApiCallback<LinkGoogleAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkGoogleAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkGoogleAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkGoogleAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkGoogleAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGoogleAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkIOSDeviceID(
@@ -1893,24 +1685,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkIOSDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkIOSDeviceIDResult>(callback)), errorCallback, customData);
+        LinkIOSDeviceID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkIOSDeviceIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkIOSDeviceID(
+        PlayFabContext& context,
+        LinkIOSDeviceIDRequest& request,
+        ProcessApiCallback<LinkIOSDeviceIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkIOSDeviceIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkIOSDeviceIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkIOSDeviceID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkIOSDeviceIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkIOSDeviceIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkKongregate(
@@ -1920,24 +1709,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkKongregate", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkKongregateAccountResult>(callback)), errorCallback, customData);
+        LinkKongregate(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkKongregateResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkKongregate(
+        PlayFabContext& context,
+        LinkKongregateAccountRequest& request,
+        ProcessApiCallback<LinkKongregateAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkKongregateAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkKongregateAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkKongregate", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkKongregateAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkKongregateAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkSteamAccount(
@@ -1947,24 +1733,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkSteamAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkSteamAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkSteamAccountResult>(callback)), errorCallback, customData);
+        LinkSteamAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkSteamAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkSteamAccount(
+        PlayFabContext& context,
+        LinkSteamAccountRequest& request,
+        ProcessApiCallback<LinkSteamAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkSteamAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkSteamAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkSteamAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkSteamAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkSteamAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkTwitch(
@@ -1974,24 +1757,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkTwitch", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkTwitchAccountResult>(callback)), errorCallback, customData);
+        LinkTwitch(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkTwitchResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkTwitch(
+        PlayFabContext& context,
+        LinkTwitchAccountRequest& request,
+        ProcessApiCallback<LinkTwitchAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkTwitchAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkTwitchAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkTwitch", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkTwitchAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkTwitchAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LinkWindowsHello(
@@ -2001,24 +1781,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkWindowsHello", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
+        LinkWindowsHello(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLinkWindowsHelloResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LinkWindowsHello(
+        PlayFabContext& context,
+        LinkWindowsHelloAccountRequest& request,
+        ProcessApiCallback<LinkWindowsHelloAccountResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LinkWindowsHelloAccountResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LinkWindowsHelloAccountResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LinkWindowsHello", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<LinkWindowsHelloAccountResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithAndroidDeviceID(
@@ -2028,31 +1805,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithAndroidDeviceID", "", "", requestJson, OnLoginWithAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithAndroidDeviceID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithAndroidDeviceID(
+        PlayFabContext& context,
+        LoginWithAndroidDeviceIDRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithAndroidDeviceID", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithCustomID(
@@ -2062,31 +1830,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithCustomID", "", "", requestJson, OnLoginWithCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithCustomID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithCustomIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithCustomID(
+        PlayFabContext& context,
+        LoginWithCustomIDRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithCustomID", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithEmailAddress(
@@ -2096,31 +1855,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithEmailAddress", "", "", requestJson, OnLoginWithEmailAddressResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithEmailAddress(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithEmailAddressResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithEmailAddress(
+        PlayFabContext& context,
+        LoginWithEmailAddressRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithEmailAddress", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithFacebook(
@@ -2130,31 +1880,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithFacebook", "", "", requestJson, OnLoginWithFacebookResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithFacebook(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithFacebookResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithFacebook(
+        PlayFabContext& context,
+        LoginWithFacebookRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithFacebook", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithGameCenter(
@@ -2164,31 +1905,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithGameCenter", "", "", requestJson, OnLoginWithGameCenterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithGameCenter(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithGameCenterResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithGameCenter(
+        PlayFabContext& context,
+        LoginWithGameCenterRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithGameCenter", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithGoogleAccount(
@@ -2198,31 +1930,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithGoogleAccount", "", "", requestJson, OnLoginWithGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithGoogleAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithGoogleAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithGoogleAccount(
+        PlayFabContext& context,
+        LoginWithGoogleAccountRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithGoogleAccount", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithIOSDeviceID(
@@ -2232,31 +1955,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithIOSDeviceID", "", "", requestJson, OnLoginWithIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithIOSDeviceID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithIOSDeviceIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithIOSDeviceID(
+        PlayFabContext& context,
+        LoginWithIOSDeviceIDRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithIOSDeviceID", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithKongregate(
@@ -2266,31 +1980,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithKongregate", "", "", requestJson, OnLoginWithKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithKongregate(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithKongregateResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithKongregate(
+        PlayFabContext& context,
+        LoginWithKongregateRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithKongregate", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithPlayFab(
@@ -2300,31 +2005,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithPlayFab", "", "", requestJson, OnLoginWithPlayFabResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithPlayFab(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithPlayFabResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithPlayFab(
+        PlayFabContext& context,
+        LoginWithPlayFabRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithPlayFab", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithSteam(
@@ -2334,31 +2030,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithSteam", "", "", requestJson, OnLoginWithSteamResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithSteam(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithSteamResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithSteam(
+        PlayFabContext& context,
+        LoginWithSteamRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithSteam", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithTwitch(
@@ -2368,31 +2055,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithTwitch", "", "", requestJson, OnLoginWithTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithTwitch(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithTwitchResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithTwitch(
+        PlayFabContext& context,
+        LoginWithTwitchRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithTwitch", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::LoginWithWindowsHello(
@@ -2402,31 +2080,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithWindowsHello", "", "", requestJson, OnLoginWithWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        LoginWithWindowsHello(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnLoginWithWindowsHelloResult(CallRequestContainer& request)
+    void PlayFabClientAPI::LoginWithWindowsHello(
+        PlayFabContext& context,
+        LoginWithWindowsHelloRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/LoginWithWindowsHello", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::Matchmake(
@@ -2436,24 +2105,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/Matchmake", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnMatchmakeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MatchmakeResult>(callback)), errorCallback, customData);
+        Matchmake(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnMatchmakeResult(CallRequestContainer& request)
+    void PlayFabClientAPI::Matchmake(
+        PlayFabContext& context,
+        MatchmakeRequest& request,
+        ProcessApiCallback<MatchmakeResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        MatchmakeResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<MatchmakeResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/Matchmake", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<MatchmakeResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MatchmakeResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OpenTrade(
@@ -2463,24 +2129,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/OpenTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnOpenTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<OpenTradeResponse>(callback)), errorCallback, customData);
+        OpenTrade(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnOpenTradeResult(CallRequestContainer& request)
+    void PlayFabClientAPI::OpenTrade(
+        PlayFabContext& context,
+        OpenTradeRequest& request,
+        ProcessApiCallback<OpenTradeResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        OpenTradeResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<OpenTradeResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/OpenTrade", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<OpenTradeResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<OpenTradeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::PayForPurchase(
@@ -2490,24 +2153,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/PayForPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnPayForPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PayForPurchaseResult>(callback)), errorCallback, customData);
+        PayForPurchase(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnPayForPurchaseResult(CallRequestContainer& request)
+    void PlayFabClientAPI::PayForPurchase(
+        PlayFabContext& context,
+        PayForPurchaseRequest& request,
+        ProcessApiCallback<PayForPurchaseResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        PayForPurchaseResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<PayForPurchaseResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/PayForPurchase", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<PayForPurchaseResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PayForPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::PurchaseItem(
@@ -2517,24 +2177,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/PurchaseItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnPurchaseItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PurchaseItemResult>(callback)), errorCallback, customData);
+        PurchaseItem(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnPurchaseItemResult(CallRequestContainer& request)
+    void PlayFabClientAPI::PurchaseItem(
+        PlayFabContext& context,
+        PurchaseItemRequest& request,
+        ProcessApiCallback<PurchaseItemResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        PurchaseItemResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<PurchaseItemResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/PurchaseItem", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<PurchaseItemResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PurchaseItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RedeemCoupon(
@@ -2544,24 +2201,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RedeemCoupon", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRedeemCouponResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
+        RedeemCoupon(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRedeemCouponResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RedeemCoupon(
+        PlayFabContext& context,
+        RedeemCouponRequest& request,
+        ProcessApiCallback<RedeemCouponResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RedeemCouponResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RedeemCouponResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RedeemCoupon", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<RedeemCouponResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RegisterForIOSPushNotification(
@@ -2571,24 +2225,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RegisterForIOSPushNotification", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRegisterForIOSPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterForIOSPushNotificationResult>(callback)), errorCallback, customData);
+        RegisterForIOSPushNotification(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRegisterForIOSPushNotificationResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RegisterForIOSPushNotification(
+        PlayFabContext& context,
+        RegisterForIOSPushNotificationRequest& request,
+        ProcessApiCallback<RegisterForIOSPushNotificationResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RegisterForIOSPushNotificationResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RegisterForIOSPushNotificationResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RegisterForIOSPushNotification", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<RegisterForIOSPushNotificationResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterForIOSPushNotificationResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RegisterPlayFabUser(
@@ -2598,30 +2249,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RegisterPlayFabUser", "", "", requestJson, OnRegisterPlayFabUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterPlayFabUserResult>(callback)), errorCallback, customData);
+        RegisterPlayFabUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRegisterPlayFabUserResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RegisterPlayFabUser(
+        PlayFabContext& context,
+        RegisterPlayFabUserRequest& request,
+        ProcessApiCallback<RegisterPlayFabUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RegisterPlayFabUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RegisterPlayFabUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RegisterPlayFabUser", "", "", std::move(requestJson), DispatchResult<RegisterPlayFabUserResult, OnRegisterPlayFabUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterPlayFabUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RegisterWithWindowsHello(
@@ -2631,31 +2274,22 @@ namespace PlayFab
         void* customData
     )
     {
-        if (PlayFabSettings::titleId.length() > 0) request.TitleId = PlayFabSettings::titleId;
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RegisterWithWindowsHello", "", "", requestJson, OnRegisterWithWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        RegisterWithWindowsHello(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRegisterWithWindowsHelloResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RegisterWithWindowsHello(
+        PlayFabContext& context,
+        RegisterWithWindowsHelloRequest& request,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        LoginResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.SessionTicket.length() > 0)
-        {
-            PlayFabSettings::clientSessionTicket = outResult.SessionTicket;
-            if (outResult.EntityToken.notNull()) PlayFabSettings::entityToken = outResult.EntityToken->EntityToken;
-            MultiStepClientLogin(outResult.SettingsForUser->NeedsAttribution);
-        }
+        if (context.GetTitleId().length() > 0) request.TitleId = context.GetTitleId();
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RegisterWithWindowsHello", "", "", std::move(requestJson), DispatchResult<LoginResult, OnLoginResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RemoveContactEmail(
@@ -2665,24 +2299,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveContactEmail", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveContactEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveContactEmailResult>(callback)), errorCallback, customData);
+        RemoveContactEmail(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRemoveContactEmailResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RemoveContactEmail(
+        PlayFabContext& context,
+        RemoveContactEmailRequest& request,
+        ProcessApiCallback<RemoveContactEmailResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemoveContactEmailResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemoveContactEmailResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RemoveContactEmail", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<RemoveContactEmailResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveContactEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RemoveFriend(
@@ -2692,24 +2323,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveFriend", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveFriendResult>(callback)), errorCallback, customData);
+        RemoveFriend(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRemoveFriendResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RemoveFriend(
+        PlayFabContext& context,
+        RemoveFriendRequest& request,
+        ProcessApiCallback<RemoveFriendResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemoveFriendResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemoveFriendResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RemoveFriend", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<RemoveFriendResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveFriendResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RemoveGenericID(
@@ -2719,24 +2347,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveGenericID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveGenericIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveGenericIDResult>(callback)), errorCallback, customData);
+        RemoveGenericID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRemoveGenericIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RemoveGenericID(
+        PlayFabContext& context,
+        RemoveGenericIDRequest& request,
+        ProcessApiCallback<RemoveGenericIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemoveGenericIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemoveGenericIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RemoveGenericID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<RemoveGenericIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveGenericIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RemoveSharedGroupMembers(
@@ -2746,24 +2371,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveSharedGroupMembers", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
+        RemoveSharedGroupMembers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRemoveSharedGroupMembersResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RemoveSharedGroupMembers(
+        PlayFabContext& context,
+        RemoveSharedGroupMembersRequest& request,
+        ProcessApiCallback<RemoveSharedGroupMembersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemoveSharedGroupMembersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemoveSharedGroupMembersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RemoveSharedGroupMembers", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<RemoveSharedGroupMembersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::ReportDeviceInfo(
@@ -2773,24 +2395,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ReportDeviceInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnReportDeviceInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        ReportDeviceInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnReportDeviceInfoResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ReportDeviceInfo(
+        PlayFabContext& context,
+        DeviceInfoRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ReportDeviceInfo", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::ReportPlayer(
@@ -2800,24 +2419,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ReportPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnReportPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerClientResult>(callback)), errorCallback, customData);
+        ReportPlayer(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnReportPlayerResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ReportPlayer(
+        PlayFabContext& context,
+        ReportPlayerClientRequest& request,
+        ProcessApiCallback<ReportPlayerClientResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ReportPlayerClientResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ReportPlayerClientResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ReportPlayer", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ReportPlayerClientResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerClientResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::RestoreIOSPurchases(
@@ -2827,24 +2443,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RestoreIOSPurchases", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRestoreIOSPurchasesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RestoreIOSPurchasesResult>(callback)), errorCallback, customData);
+        RestoreIOSPurchases(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnRestoreIOSPurchasesResult(CallRequestContainer& request)
+    void PlayFabClientAPI::RestoreIOSPurchases(
+        PlayFabContext& context,
+        RestoreIOSPurchasesRequest& request,
+        ProcessApiCallback<RestoreIOSPurchasesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RestoreIOSPurchasesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RestoreIOSPurchasesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/RestoreIOSPurchases", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<RestoreIOSPurchasesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RestoreIOSPurchasesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::SendAccountRecoveryEmail(
@@ -2854,24 +2467,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SendAccountRecoveryEmail", "", "", requestJson, OnSendAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
+        SendAccountRecoveryEmail(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnSendAccountRecoveryEmailResult(CallRequestContainer& request)
+    void PlayFabClientAPI::SendAccountRecoveryEmail(
+        PlayFabContext& context,
+        SendAccountRecoveryEmailRequest& request,
+        ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SendAccountRecoveryEmailResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SendAccountRecoveryEmailResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/SendAccountRecoveryEmail", "", "", std::move(requestJson), DispatchResult<SendAccountRecoveryEmailResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::SetFriendTags(
@@ -2881,24 +2491,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SetFriendTags", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSetFriendTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetFriendTagsResult>(callback)), errorCallback, customData);
+        SetFriendTags(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnSetFriendTagsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::SetFriendTags(
+        PlayFabContext& context,
+        SetFriendTagsRequest& request,
+        ProcessApiCallback<SetFriendTagsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetFriendTagsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetFriendTagsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/SetFriendTags", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<SetFriendTagsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetFriendTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::SetPlayerSecret(
@@ -2908,24 +2515,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SetPlayerSecret", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
+        SetPlayerSecret(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnSetPlayerSecretResult(CallRequestContainer& request)
+    void PlayFabClientAPI::SetPlayerSecret(
+        PlayFabContext& context,
+        SetPlayerSecretRequest& request,
+        ProcessApiCallback<SetPlayerSecretResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetPlayerSecretResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetPlayerSecretResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/SetPlayerSecret", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<SetPlayerSecretResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::StartGame(
@@ -2935,24 +2539,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/StartGame", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnStartGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResult>(callback)), errorCallback, customData);
+        StartGame(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnStartGameResult(CallRequestContainer& request)
+    void PlayFabClientAPI::StartGame(
+        PlayFabContext& context,
+        StartGameRequest& request,
+        ProcessApiCallback<StartGameResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        StartGameResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<StartGameResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/StartGame", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<StartGameResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::StartPurchase(
@@ -2962,27 +2563,35 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/StartPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnStartPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartPurchaseResult>(callback)), errorCallback, customData);
+        StartPurchase(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnStartPurchaseResult(CallRequestContainer& request)
+    void PlayFabClientAPI::StartPurchase(
+        PlayFabContext& context,
+        StartPurchaseRequest& request,
+        ProcessApiCallback<StartPurchaseResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        StartPurchaseResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<StartPurchaseResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/StartPurchase", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<StartPurchaseResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartPurchaseResult>(callback)), errorCallback, customData);
+    }
+
+    void PlayFabClientAPI::SubtractUserVirtualCurrency(
+        SubtractUserVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        SubtractUserVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::SubtractUserVirtualCurrency(
+        PlayFabContext& context,
         SubtractUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2990,26 +2599,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SubtractUserVirtualCurrency", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/SubtractUserVirtualCurrency", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ModifyUserVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnSubtractUserVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkAndroidDeviceID(
+        UnlinkAndroidDeviceIDRequest& request,
+        ProcessApiCallback<UnlinkAndroidDeviceIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyUserVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkAndroidDeviceID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkAndroidDeviceID(
+        PlayFabContext& context,
         UnlinkAndroidDeviceIDRequest& request,
         ProcessApiCallback<UnlinkAndroidDeviceIDResult> callback,
         ErrorCallback errorCallback,
@@ -3017,26 +2623,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkAndroidDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkAndroidDeviceID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkAndroidDeviceIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkAndroidDeviceIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkCustomID(
+        UnlinkCustomIDRequest& request,
+        ProcessApiCallback<UnlinkCustomIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkAndroidDeviceIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkAndroidDeviceIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkCustomID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkCustomID(
+        PlayFabContext& context,
         UnlinkCustomIDRequest& request,
         ProcessApiCallback<UnlinkCustomIDResult> callback,
         ErrorCallback errorCallback,
@@ -3044,26 +2647,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkCustomID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkCustomIDResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkCustomID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkCustomIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkCustomIDResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkCustomIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkFacebookAccount(
+        UnlinkFacebookAccountRequest& request,
+        ProcessApiCallback<UnlinkFacebookAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkCustomIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkCustomIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkFacebookAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkFacebookAccount(
+        PlayFabContext& context,
         UnlinkFacebookAccountRequest& request,
         ProcessApiCallback<UnlinkFacebookAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3071,26 +2671,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkFacebookAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkFacebookAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkFacebookAccountResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkFacebookAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkFacebookAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkFacebookAccountResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkFacebookAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkGameCenterAccount(
+        UnlinkGameCenterAccountRequest& request,
+        ProcessApiCallback<UnlinkGameCenterAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkFacebookAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkFacebookAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkGameCenterAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkGameCenterAccount(
+        PlayFabContext& context,
         UnlinkGameCenterAccountRequest& request,
         ProcessApiCallback<UnlinkGameCenterAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3098,26 +2695,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkGameCenterAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkGameCenterAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGameCenterAccountResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkGameCenterAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkGameCenterAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGameCenterAccountResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkGameCenterAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkGoogleAccount(
+        UnlinkGoogleAccountRequest& request,
+        ProcessApiCallback<UnlinkGoogleAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkGameCenterAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkGameCenterAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkGoogleAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkGoogleAccount(
+        PlayFabContext& context,
         UnlinkGoogleAccountRequest& request,
         ProcessApiCallback<UnlinkGoogleAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3125,26 +2719,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkGoogleAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGoogleAccountResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkGoogleAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkGoogleAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGoogleAccountResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkGoogleAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkIOSDeviceID(
+        UnlinkIOSDeviceIDRequest& request,
+        ProcessApiCallback<UnlinkIOSDeviceIDResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkGoogleAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkGoogleAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkIOSDeviceID(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkIOSDeviceID(
+        PlayFabContext& context,
         UnlinkIOSDeviceIDRequest& request,
         ProcessApiCallback<UnlinkIOSDeviceIDResult> callback,
         ErrorCallback errorCallback,
@@ -3152,26 +2743,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkIOSDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkIOSDeviceIDResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkIOSDeviceID", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkIOSDeviceIDResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkIOSDeviceIDResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkIOSDeviceIDResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkKongregate(
+        UnlinkKongregateAccountRequest& request,
+        ProcessApiCallback<UnlinkKongregateAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkIOSDeviceIDResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkIOSDeviceIDResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkKongregate(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkKongregate(
+        PlayFabContext& context,
         UnlinkKongregateAccountRequest& request,
         ProcessApiCallback<UnlinkKongregateAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3179,26 +2767,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkKongregate", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkKongregateAccountResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkKongregate", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkKongregateAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkKongregateAccountResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkKongregateResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkSteamAccount(
+        UnlinkSteamAccountRequest& request,
+        ProcessApiCallback<UnlinkSteamAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkKongregateAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkKongregateAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkSteamAccount(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkSteamAccount(
+        PlayFabContext& context,
         UnlinkSteamAccountRequest& request,
         ProcessApiCallback<UnlinkSteamAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3206,26 +2791,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkSteamAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkSteamAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkSteamAccountResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkSteamAccount", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkSteamAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkSteamAccountResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkSteamAccountResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkTwitch(
+        UnlinkTwitchAccountRequest& request,
+        ProcessApiCallback<UnlinkTwitchAccountResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkSteamAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkSteamAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkTwitch(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkTwitch(
+        PlayFabContext& context,
         UnlinkTwitchAccountRequest& request,
         ProcessApiCallback<UnlinkTwitchAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3233,26 +2815,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkTwitch", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkTwitchAccountResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkTwitch", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkTwitchAccountResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkTwitchAccountResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkTwitchResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlinkWindowsHello(
+        UnlinkWindowsHelloAccountRequest& request,
+        ProcessApiCallback<UnlinkWindowsHelloAccountResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkTwitchAccountResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkTwitchAccountResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlinkWindowsHello(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlinkWindowsHello(
+        PlayFabContext& context,
         UnlinkWindowsHelloAccountRequest& request,
         ProcessApiCallback<UnlinkWindowsHelloAccountResponse> callback,
         ErrorCallback errorCallback,
@@ -3260,26 +2839,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkWindowsHello", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlinkWindowsHello", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlinkWindowsHelloAccountResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlinkWindowsHelloResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlockContainerInstance(
+        UnlockContainerInstanceRequest& request,
+        ProcessApiCallback<UnlockContainerItemResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlinkWindowsHelloAccountResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlinkWindowsHelloAccountResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlockContainerInstance(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlockContainerInstance(
+        PlayFabContext& context,
         UnlockContainerInstanceRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -3287,26 +2863,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlockContainerInstance", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlockContainerInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlockContainerInstance", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlockContainerItemResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlockContainerInstanceResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UnlockContainerItem(
+        UnlockContainerItemRequest& request,
+        ProcessApiCallback<UnlockContainerItemResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlockContainerItemResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlockContainerItemResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlockContainerItem(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UnlockContainerItem(
+        PlayFabContext& context,
         UnlockContainerItemRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -3314,26 +2887,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlockContainerItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlockContainerItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UnlockContainerItem", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UnlockContainerItemResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUnlockContainerItemResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdateAvatarUrl(
+        UpdateAvatarUrlRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlockContainerItemResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlockContainerItemResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateAvatarUrl(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdateAvatarUrl(
+        PlayFabContext& context,
         UpdateAvatarUrlRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -3341,26 +2911,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateAvatarUrl", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateAvatarUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdateAvatarUrl", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdateAvatarUrlResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdateCharacterData(
+        UpdateCharacterDataRequest& request,
+        ProcessApiCallback<UpdateCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCharacterData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdateCharacterData(
+        PlayFabContext& context,
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -3368,26 +2935,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateCharacterData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdateCharacterData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UpdateCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdateCharacterDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdateCharacterStatistics(
+        UpdateCharacterStatisticsRequest& request,
+        ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCharacterStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdateCharacterStatistics(
+        PlayFabContext& context,
         UpdateCharacterStatisticsRequest& request,
         ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -3395,26 +2959,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateCharacterStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdateCharacterStatistics", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UpdateCharacterStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdateCharacterStatisticsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdatePlayerStatistics(
+        UpdatePlayerStatisticsRequest& request,
+        ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCharacterStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCharacterStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdatePlayerStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdatePlayerStatistics(
+        PlayFabContext& context,
         UpdatePlayerStatisticsRequest& request,
         ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -3422,26 +2983,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdatePlayerStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdatePlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdatePlayerStatistics", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UpdatePlayerStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdatePlayerStatisticsResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdateSharedGroupData(
+        UpdateSharedGroupDataRequest& request,
+        ProcessApiCallback<UpdateSharedGroupDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdatePlayerStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdatePlayerStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateSharedGroupData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdateSharedGroupData(
+        PlayFabContext& context,
         UpdateSharedGroupDataRequest& request,
         ProcessApiCallback<UpdateSharedGroupDataResult> callback,
         ErrorCallback errorCallback,
@@ -3449,26 +3007,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateSharedGroupData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdateSharedGroupData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UpdateSharedGroupDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdateSharedGroupDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdateUserData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateSharedGroupDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateSharedGroupDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdateUserData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -3476,26 +3031,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateUserData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdateUserData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdateUserDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdateUserPublisherData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdateUserPublisherData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -3503,26 +3055,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateUserPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdateUserPublisherData", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdateUserPublisherDataResult(CallRequestContainer& request)
+    void PlayFabClientAPI::UpdateUserTitleDisplayName(
+        UpdateUserTitleDisplayNameRequest& request,
+        ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserTitleDisplayName(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::UpdateUserTitleDisplayName(
+        PlayFabContext& context,
         UpdateUserTitleDisplayNameRequest& request,
         ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
         ErrorCallback errorCallback,
@@ -3530,26 +3079,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateUserTitleDisplayName", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserTitleDisplayNameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/UpdateUserTitleDisplayName", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<UpdateUserTitleDisplayNameResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnUpdateUserTitleDisplayNameResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ValidateAmazonIAPReceipt(
+        ValidateAmazonReceiptRequest& request,
+        ProcessApiCallback<ValidateAmazonReceiptResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserTitleDisplayNameResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserTitleDisplayNameResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ValidateAmazonIAPReceipt(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::ValidateAmazonIAPReceipt(
+        PlayFabContext& context,
         ValidateAmazonReceiptRequest& request,
         ProcessApiCallback<ValidateAmazonReceiptResult> callback,
         ErrorCallback errorCallback,
@@ -3557,26 +3103,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateAmazonIAPReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateAmazonIAPReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateAmazonReceiptResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ValidateAmazonIAPReceipt", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ValidateAmazonReceiptResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateAmazonReceiptResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnValidateAmazonIAPReceiptResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ValidateGooglePlayPurchase(
+        ValidateGooglePlayPurchaseRequest& request,
+        ProcessApiCallback<ValidateGooglePlayPurchaseResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ValidateAmazonReceiptResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ValidateAmazonReceiptResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ValidateGooglePlayPurchase(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::ValidateGooglePlayPurchase(
+        PlayFabContext& context,
         ValidateGooglePlayPurchaseRequest& request,
         ProcessApiCallback<ValidateGooglePlayPurchaseResult> callback,
         ErrorCallback errorCallback,
@@ -3584,26 +3127,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateGooglePlayPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateGooglePlayPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateGooglePlayPurchaseResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ValidateGooglePlayPurchase", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ValidateGooglePlayPurchaseResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateGooglePlayPurchaseResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnValidateGooglePlayPurchaseResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ValidateIOSReceipt(
+        ValidateIOSReceiptRequest& request,
+        ProcessApiCallback<ValidateIOSReceiptResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ValidateGooglePlayPurchaseResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ValidateGooglePlayPurchaseResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ValidateIOSReceipt(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::ValidateIOSReceipt(
+        PlayFabContext& context,
         ValidateIOSReceiptRequest& request,
         ProcessApiCallback<ValidateIOSReceiptResult> callback,
         ErrorCallback errorCallback,
@@ -3611,26 +3151,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateIOSReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateIOSReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateIOSReceiptResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ValidateIOSReceipt", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ValidateIOSReceiptResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateIOSReceiptResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnValidateIOSReceiptResult(CallRequestContainer& request)
+    void PlayFabClientAPI::ValidateWindowsStoreReceipt(
+        ValidateWindowsReceiptRequest& request,
+        ProcessApiCallback<ValidateWindowsReceiptResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ValidateIOSReceiptResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ValidateIOSReceiptResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ValidateWindowsStoreReceipt(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::ValidateWindowsStoreReceipt(
+        PlayFabContext& context,
         ValidateWindowsReceiptRequest& request,
         ProcessApiCallback<ValidateWindowsReceiptResult> callback,
         ErrorCallback errorCallback,
@@ -3638,26 +3175,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateWindowsStoreReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateWindowsStoreReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateWindowsReceiptResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/ValidateWindowsStoreReceipt", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<ValidateWindowsReceiptResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateWindowsReceiptResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnValidateWindowsStoreReceiptResult(CallRequestContainer& request)
+    void PlayFabClientAPI::WriteCharacterEvent(
+        WriteClientCharacterEventRequest& request,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ValidateWindowsReceiptResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ValidateWindowsReceiptResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        WriteCharacterEvent(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::WriteCharacterEvent(
+        PlayFabContext& context,
         WriteClientCharacterEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3665,26 +3199,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/WriteCharacterEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWriteCharacterEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/WriteCharacterEvent", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<WriteEventResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnWriteCharacterEventResult(CallRequestContainer& request)
+    void PlayFabClientAPI::WritePlayerEvent(
+        WriteClientPlayerEventRequest& request,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        WriteEventResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        WritePlayerEvent(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::WritePlayerEvent(
+        PlayFabContext& context,
         WriteClientPlayerEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3692,26 +3223,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/WritePlayerEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWritePlayerEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/WritePlayerEvent", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<WriteEventResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabClientAPI::OnWritePlayerEventResult(CallRequestContainer& request)
+    void PlayFabClientAPI::WriteTitleEvent(
+        WriteTitleEventRequest& request,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        WriteEventResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        WriteTitleEvent(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabClientAPI::WriteTitleEvent(
+        PlayFabContext& context,
         WriteTitleEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3719,32 +3247,48 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/WriteTitleEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWriteTitleEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Client/WriteTitleEvent", "X-Authorization", context.GetClientSessionTicket(), std::move(requestJson), DispatchResult<WriteEventResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+    }
+
+    // Results the API keeps something from, before passing them on
+    void PlayFabClientAPI::OnAttributeInstallResult(CallRequestContainer&, const AttributeInstallResult&)
+    {
+        PlayFabSettings::advertisingIdType += "_Successful";
     }
 
-    void PlayFabClientAPI::OnWriteTitleEventResult(CallRequestContainer& request)
+    void PlayFabClientAPI::OnLoginResult(CallRequestContainer& request, const LoginResult& outResult)
     {
-        WriteEventResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
+        if (outResult.SessionTicket.length() > 0)
+        {
+            request.context->SetClientSessionTicket(outResult.SessionTicket);
+            if (outResult.EntityToken.notNull()) request.context->SetEntityToken(outResult.EntityToken->EntityToken, outResult.EntityToken->TokenExpiration);
+            MultiStepClientLogin(*request.context, outResult.SettingsForUser->NeedsAttribution);
+        }
+    }
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
+    void PlayFabClientAPI::OnRegisterPlayFabUserResult(CallRequestContainer& request, const RegisterPlayFabUserResult& outResult)
+    {
+        if (outResult.SessionTicket.length() > 0)
         {
-            const auto callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr));
-            callback(outResult, request.customData);
+            request.context->SetClientSessionTicket(outResult.SessionTicket);
+            MultiStepClientLogin(*request.context, outResult.SettingsForUser->NeedsAttribution);
         }
     }
 
     // Private PlayFabClientAPI specific
     bool PlayFabClientAPI::IsClientLoggedIn()
     {
-        return !PlayFabSettings::clientSessionTicket.empty();
+        return IsClientLoggedIn(PlayFabContext::Default());
+    }
+
+    bool PlayFabClientAPI::IsClientLoggedIn(PlayFabContext& context)
+    {
+        return !context.GetClientSessionTicket().empty();
     }
 
-    void PlayFabClientAPI::MultiStepClientLogin(bool needsAttribution)
+    void PlayFabClientAPI::MultiStepClientLogin(PlayFabContext& context, bool needsAttribution)
     {
         if (needsAttribution && !PlayFabSettings::disableAdvertising && PlayFabSettings::advertisingIdType.length() > 0 && PlayFabSettings::advertisingIdValue.length() > 0)
         {
@@ -3755,7 +3299,7 @@ namespace PlayFab
                 request.Adid = PlayFabSettings::advertisingIdValue;
             else
                 return;
-            AttributeInstall(request, nullptr, nullptr);
+            AttributeInstall(context, request, nullptr, nullptr);
         }
     }
 }
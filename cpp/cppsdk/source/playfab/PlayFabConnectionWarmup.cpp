@@ -0,0 +1,90 @@
+#include <gsdkCommonPch.h>
+
+#include <playfab/PlayFabConnectionWarmup.h>
+#include <playfab/PlayFabSettings.h>
+#include <gsdk.h>
+
+namespace PlayFab
+{
+    std::mutex PlayFabConnectionWarmup::warmupMutex;
+    std::condition_variable PlayFabConnectionWarmup::stopCondition;
+    std::thread PlayFabConnectionWarmup::keepAliveThread;
+    bool PlayFabConnectionWarmup::keepAliveRunning = false;
+    unsigned int PlayFabConnectionWarmup::keepAliveGeneration = 0;
+    PlayFabConnectionWarmup::Status PlayFabConnectionWarmup::status = PlayFabConnectionWarmup::Status::NotStarted;
+    Microsoft::Azure::Gaming::GSDKSubscriptionId PlayFabConnectionWarmup::allocationSubscription = 0;
+
+    void PlayFabConnectionWarmup::Start(const PlayFabWarmupSettings& settings)
+    {
+        std::unique_lock<std::mutex> lock(warmupMutex);
+        if (keepAliveRunning || keepAliveThread.joinable())
+            return;
+
+        // A thread from before the last Stop may still be finishing its warm-up, and leaves as soon as it sees the new generation
+        keepAliveRunning = true;
+        status = Status::WarmingUp;
+        keepAliveThread = std::thread(&PlayFabConnectionWarmup::KeepAliveThread, settings, ++keepAliveGeneration);
+
+        // On the GSDK's worker, because Stop joins the keep-alive thread.
+        // Only once the game has started the GSDK, as subscribing would otherwise start it.
+        if (settings.stopOnAllocation && Microsoft::Azure::Gaming::GSDK::isStarted())
+        {
+            using namespace Microsoft::Azure::Gaming;
+            allocationSubscription = GSDK::subscribe(GSDKEventType::Allocation, [](const GSDKEvent&) { Stop(); }, GSDKEventExecutor::Worker);
+        }
+    }
+
+    void PlayFabConnectionWarmup::Stop()
+    {
+        Microsoft::Azure::Gaming::GSDKSubscriptionId subscription;
+        std::thread toJoin;
+        { // LOCK warmupMutex
+            std::unique_lock<std::mutex> lock(warmupMutex);
+            keepAliveRunning = false;
+            ++keepAliveGeneration;
+            subscription = allocationSubscription;
+            allocationSubscription = 0;
+
+            // Taken while locked, so of two concurrent Stops (e.g. the game's and stopOnAllocation's) only one joins it
+            toJoin = std::move(keepAliveThread);
+        } // UNLOCK warmupMutex
+
+        if (subscription != 0)
+            Microsoft::Azure::Gaming::GSDK::unsubscribe(subscription);
+
+        stopCondition.notify_all();
+        if (toJoin.joinable())
+            toJoin.join();
+    }
+
+    PlayFabConnectionWarmup::Status PlayFabConnectionWarmup::GetStatus()
+    {
+        std::unique_lock<std::mutex> lock(warmupMutex);
+        return status;
+    }
+
+    bool PlayFabConnectionWarmup::IsWarm()
+    {
+        return GetStatus() == Status::Warm;
+    }
+
+    void PlayFabConnectionWarmup::KeepAliveThread(PlayFabWarmupSettings settings, unsigned int generation)
+    {
+        const size_t connectionCount = settings.connectionCount != 0 ? settings.connectionCount : (std::max)(PlayFabSettings::maxConcurrentRequests, static_cast<size_t>(1));
+        IPlayFabHttp& http = IPlayFabHttp::Get();
+
+        std::unique_lock<std::mutex> lock(warmupMutex);
+        while (generation == keepAliveGeneration)
+        {
+            lock.unlock();
+            const size_t warmed = http.WarmConnections(connectionCount);
+            lock.lock();
+
+            if (generation != keepAliveGeneration)
+                break;
+            status = warmed != 0 ? Status::Warm : Status::Failed;
+
+            stopCondition.wait_for(lock, std::chrono::seconds(settings.keepAliveIntervalSeconds), [generation]() { return generation != keepAliveGeneration; });
+        }
+    }
+}
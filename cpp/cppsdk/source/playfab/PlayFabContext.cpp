@@ -0,0 +1,162 @@
+#include <gsdkCommonPch.h>
+
+#include <playfab/PlayFabContext.h>
+#include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabEntityTokenManager.h>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// The context behind the static API, which keeps its settings and credentials where they have always been
+    /// </summary>
+    class DefaultPlayFabContext : public PlayFabContext
+    {
+    public:
+        IPlayFabHttp& GetHttp() override
+        {
+            return IPlayFabHttp::Get();
+        }
+
+        std::string GetUrl(const std::string& urlPath) const override
+        {
+            return PlayFabSettings::GetUrl(urlPath);
+        }
+
+        std::string GetTitleId() const override
+        {
+            return PlayFabSettings::titleId;
+        }
+
+        std::string GetDeveloperSecretKey() const override
+        {
+#if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
+            return PlayFabSettings::developerSecretKey;
+#else
+            return std::string();
+#endif
+        }
+
+        std::string GetClientSessionTicket() const override
+        {
+#ifndef DISABLE_PLAYFABCLIENT_API
+            return PlayFabSettings::clientSessionTicket;
+#else
+            return std::string();
+#endif
+        }
+
+        void SetClientSessionTicket(const std::string& sessionTicket) override
+        {
+#ifndef DISABLE_PLAYFABCLIENT_API
+            PlayFabSettings::clientSessionTicket = sessionTicket;
+#else
+            (void)sessionTicket;
+#endif
+        }
+
+        std::string GetEntityToken() const override
+        {
+            return PlayFabEntityTokenManager::GetToken()->token;
+        }
+
+        void SetEntityToken(const std::string& token, const Boxed<time_t>& expiration) override
+        {
+            PlayFabEntityTokenManager::SetToken(token, expiration);
+        }
+
+        void ForgetAllCredentials() override
+        {
+            PlayFabSettings::ForgetAllCredentials();
+        }
+
+        void AddEntityRequest(const std::string& urlPath, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) override
+        {
+#ifdef ENABLE_PLAYFABENTITY_API
+            // Goes through the token manager, which holds requests back while it refreshes the token
+            PlayFabEntityTokenManager::AddRequest(urlPath, std::move(requestBody), internalCallback, successCallback, errorCallback, customData);
+#else
+            PlayFabContext::AddEntityRequest(urlPath, std::move(requestBody), internalCallback, successCallback, errorCallback, customData);
+#endif
+        }
+    };
+
+    PlayFabContext::PlayFabContext()
+    {
+    }
+
+    PlayFabContext::PlayFabContext(const PlayFabContextSettings& settings) :
+        settings(settings),
+        serverUrl("https://" + settings.titleId + (settings.useDevelopmentEnvironment ? settings.developmentEnvironmentURL : settings.productionEnvironmentURL)),
+        http(new PlayFabHttp(*this, settings.maxConcurrentRequests))
+    {
+    }
+
+    PlayFabContext::~PlayFabContext()
+    {
+        // Joins the transport's threads while the rest of the context is still there for their callbacks
+        http.reset();
+    }
+
+    PlayFabContext& PlayFabContext::Default()
+    {
+        static DefaultPlayFabContext defaultContext;
+        return defaultContext;
+    }
+
+    IPlayFabHttp& PlayFabContext::GetHttp()
+    {
+        return *http;
+    }
+
+    std::string PlayFabContext::GetUrl(const std::string& urlPath) const
+    {
+        return serverUrl + urlPath;
+    }
+
+    std::string PlayFabContext::GetTitleId() const
+    {
+        return settings.titleId;
+    }
+
+    std::string PlayFabContext::GetDeveloperSecretKey() const
+    {
+        return settings.developerSecretKey;
+    }
+
+    std::string PlayFabContext::GetClientSessionTicket() const
+    {
+        std::unique_lock<std::mutex> lock(credentialsMutex);
+        return clientSessionTicket;
+    }
+
+    void PlayFabContext::SetClientSessionTicket(const std::string& sessionTicket)
+    {
+        std::unique_lock<std::mutex> lock(credentialsMutex);
+        clientSessionTicket = sessionTicket;
+    }
+
+    std::string PlayFabContext::GetEntityToken() const
+    {
+        std::unique_lock<std::mutex> lock(credentialsMutex);
+        return entityToken;
+    }
+
+    void PlayFabContext::SetEntityToken(const std::string& token, const Boxed<time_t>&)
+    {
+        // Contexts have no background refresh, so the expiration is not needed
+        std::unique_lock<std::mutex> lock(credentialsMutex);
+        entityToken = token;
+    }
+
+    void PlayFabContext::ForgetAllCredentials()
+    {
+        std::unique_lock<std::mutex> lock(credentialsMutex);
+        clientSessionTicket.clear();
+        entityToken.clear();
+    }
+
+    void PlayFabContext::AddEntityRequest(const std::string& urlPath, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData)
+    {
+        GetHttp().AddRequest(urlPath, "X-EntityToken", GetEntityToken(), std::move(requestBody), internalCallback, successCallback, errorCallback, customData);
+    }
+}
@@ -29,24 +29,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/File/AbortFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAbortFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AbortFileUploadsResponse>(callback)), errorCallback, customData);
+        AbortFileUploads(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnAbortFileUploadsResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::AbortFileUploads(
+        PlayFabContext& context,
+        AbortFileUploadsRequest& request,
+        ProcessApiCallback<AbortFileUploadsResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AbortFileUploadsResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AbortFileUploadsResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/File/AbortFileUploads", std::move(requestJson), DispatchResult<AbortFileUploadsResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AbortFileUploadsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::AcceptGroupApplication(
@@ -56,24 +52,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/AcceptGroupApplication", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAcceptGroupApplicationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        AcceptGroupApplication(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnAcceptGroupApplicationResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::AcceptGroupApplication(
+        PlayFabContext& context,
+        AcceptGroupApplicationRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/AcceptGroupApplication", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::AcceptGroupInvitation(
@@ -83,24 +75,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/AcceptGroupInvitation", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAcceptGroupInvitationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        AcceptGroupInvitation(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnAcceptGroupInvitationResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::AcceptGroupInvitation(
+        PlayFabContext& context,
+        AcceptGroupInvitationRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/AcceptGroupInvitation", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::AddMembers(
@@ -110,24 +98,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/AddMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAddMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        AddMembers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnAddMembersResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::AddMembers(
+        PlayFabContext& context,
+        AddMembersRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/AddMembers", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ApplyToGroup(
@@ -137,24 +121,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ApplyToGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnApplyToGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ApplyToGroupResponse>(callback)), errorCallback, customData);
+        ApplyToGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnApplyToGroupResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ApplyToGroup(
+        PlayFabContext& context,
+        ApplyToGroupRequest& request,
+        ProcessApiCallback<ApplyToGroupResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ApplyToGroupResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ApplyToGroupResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ApplyToGroup", std::move(requestJson), DispatchResult<ApplyToGroupResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ApplyToGroupResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::BlockEntity(
@@ -164,24 +144,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/BlockEntity", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnBlockEntityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        BlockEntity(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnBlockEntityResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::BlockEntity(
+        PlayFabContext& context,
+        BlockEntityRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/BlockEntity", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ChangeMemberRole(
@@ -191,24 +167,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ChangeMemberRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnChangeMemberRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        ChangeMemberRole(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnChangeMemberRoleResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ChangeMemberRole(
+        PlayFabContext& context,
+        ChangeMemberRoleRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ChangeMemberRole", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::CreateGroup(
@@ -218,24 +190,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/CreateGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnCreateGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupResponse>(callback)), errorCallback, customData);
+        CreateGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnCreateGroupResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::CreateGroup(
+        PlayFabContext& context,
+        CreateGroupRequest& request,
+        ProcessApiCallback<CreateGroupResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreateGroupResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreateGroupResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/CreateGroup", std::move(requestJson), DispatchResult<CreateGroupResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::CreateRole(
@@ -245,24 +213,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/CreateRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnCreateRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupRoleResponse>(callback)), errorCallback, customData);
+        CreateRole(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnCreateRoleResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::CreateRole(
+        PlayFabContext& context,
+        CreateGroupRoleRequest& request,
+        ProcessApiCallback<CreateGroupRoleResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreateGroupRoleResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreateGroupRoleResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/CreateRole", std::move(requestJson), DispatchResult<CreateGroupRoleResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupRoleResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::DeleteFiles(
@@ -272,24 +236,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/File/DeleteFiles", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteFilesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteFilesResponse>(callback)), errorCallback, customData);
+        DeleteFiles(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnDeleteFilesResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::DeleteFiles(
+        PlayFabContext& context,
+        DeleteFilesRequest& request,
+        ProcessApiCallback<DeleteFilesResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeleteFilesResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeleteFilesResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/File/DeleteFiles", std::move(requestJson), DispatchResult<DeleteFilesResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteFilesResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::DeleteGroup(
@@ -299,24 +259,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/DeleteGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        DeleteGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnDeleteGroupResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::DeleteGroup(
+        PlayFabContext& context,
+        DeleteGroupRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/DeleteGroup", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::DeleteRole(
@@ -326,24 +282,20 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/DeleteRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        DeleteRole(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnDeleteRoleResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::DeleteRole(
+        PlayFabContext& context,
+        DeleteRoleRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/DeleteRole", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::FinalizeFileUploads(
@@ -353,27 +305,34 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/File/FinalizeFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnFinalizeFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<FinalizeFileUploadsResponse>(callback)), errorCallback, customData);
+        FinalizeFileUploads(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnFinalizeFileUploadsResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::FinalizeFileUploads(
+        PlayFabContext& context,
+        FinalizeFileUploadsRequest& request,
+        ProcessApiCallback<FinalizeFileUploadsResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        FinalizeFileUploadsResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<FinalizeFileUploadsResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/File/FinalizeFileUploads", std::move(requestJson), DispatchResult<FinalizeFileUploadsResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<FinalizeFileUploadsResponse>(callback)), errorCallback, customData);
+    }
+
+    void PlayFabEntityAPI::GetEntityToken(
+        GetEntityTokenRequest& request,
+        ProcessApiCallback<GetEntityTokenResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        GetEntityToken(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::GetEntityToken(
+        PlayFabContext& context,
         GetEntityTokenRequest& request,
         ProcessApiCallback<GetEntityTokenResponse> callback,
         ErrorCallback errorCallback,
@@ -381,35 +340,32 @@ namespace PlayFab
     )
     {
         std::string authKey, authValue;
-        if (PlayFabSettings::entityToken.length() > 0) {
-            authKey = "X-EntityToken"; authValue = PlayFabSettings::entityToken;
-        } else if (PlayFabSettings::clientSessionTicket.length() > 0) {
-            authKey = "X-Authorization"; authValue = PlayFabSettings::clientSessionTicket;
-        } else if (PlayFabSettings::developerSecretKey.length() > 0) {
-            authKey = "X-SecretKey"; authValue = PlayFabSettings::developerSecretKey;
+        const std::string entityToken = context.GetEntityToken();
+        if (entityToken.length() > 0) {
+            authKey = "X-EntityToken"; authValue = entityToken;
+        } else if (context.GetClientSessionTicket().length() > 0) {
+            authKey = "X-Authorization"; authValue = context.GetClientSessionTicket();
+        } else if (context.GetDeveloperSecretKey().length() > 0) {
+            authKey = "X-SecretKey"; authValue = context.GetDeveloperSecretKey();
         }
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Authentication/GetEntityToken", authKey, authValue, requestJson, OnGetEntityTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityTokenResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Authentication/GetEntityToken", authKey, authValue, std::move(requestJson), DispatchResult<GetEntityTokenResponse, OnGetEntityTokenResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityTokenResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnGetEntityTokenResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::GetFiles(
+        GetFilesRequest& request,
+        ProcessApiCallback<GetFilesResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetEntityTokenResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-        if (outResult.EntityToken.length() > 0) PlayFabSettings::entityToken = outResult.EntityToken;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetEntityTokenResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetFiles(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::GetFiles(
+        PlayFabContext& context,
         GetFilesRequest& request,
         ProcessApiCallback<GetFilesResponse> callback,
         ErrorCallback errorCallback,
@@ -417,26 +373,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/File/GetFiles", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetFilesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFilesResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/File/GetFiles", std::move(requestJson), DispatchResult<GetFilesResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFilesResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnGetFilesResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::GetGlobalPolicy(
+        GetGlobalPolicyRequest& request,
+        ProcessApiCallback<GetGlobalPolicyResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetFilesResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetFilesResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetGlobalPolicy(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::GetGlobalPolicy(
+        PlayFabContext& context,
         GetGlobalPolicyRequest& request,
         ProcessApiCallback<GetGlobalPolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -444,26 +396,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/GetGlobalPolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetGlobalPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGlobalPolicyResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Profile/GetGlobalPolicy", std::move(requestJson), DispatchResult<GetGlobalPolicyResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGlobalPolicyResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnGetGlobalPolicyResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::GetGroup(
+        GetGroupRequest& request,
+        ProcessApiCallback<GetGroupResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetGlobalPolicyResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetGlobalPolicyResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::GetGroup(
+        PlayFabContext& context,
         GetGroupRequest& request,
         ProcessApiCallback<GetGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -471,26 +419,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/GetGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGroupResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/GetGroup", std::move(requestJson), DispatchResult<GetGroupResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGroupResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnGetGroupResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::GetObjects(
+        GetObjectsRequest& request,
+        ProcessApiCallback<GetObjectsResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetGroupResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetGroupResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetObjects(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::GetObjects(
+        PlayFabContext& context,
         GetObjectsRequest& request,
         ProcessApiCallback<GetObjectsResponse> callback,
         ErrorCallback errorCallback,
@@ -498,26 +442,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Object/GetObjects", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetObjectsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetObjectsResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Object/GetObjects", std::move(requestJson), DispatchResult<GetObjectsResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetObjectsResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnGetObjectsResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::GetProfile(
+        GetEntityProfileRequest& request,
+        ProcessApiCallback<GetEntityProfileResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetObjectsResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetObjectsResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetProfile(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::GetProfile(
+        PlayFabContext& context,
         GetEntityProfileRequest& request,
         ProcessApiCallback<GetEntityProfileResponse> callback,
         ErrorCallback errorCallback,
@@ -525,26 +465,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/GetProfile", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityProfileResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Profile/GetProfile", std::move(requestJson), DispatchResult<GetEntityProfileResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityProfileResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnGetProfileResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::InitiateFileUploads(
+        InitiateFileUploadsRequest& request,
+        ProcessApiCallback<InitiateFileUploadsResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetEntityProfileResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetEntityProfileResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        InitiateFileUploads(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::InitiateFileUploads(
+        PlayFabContext& context,
         InitiateFileUploadsRequest& request,
         ProcessApiCallback<InitiateFileUploadsResponse> callback,
         ErrorCallback errorCallback,
@@ -552,26 +488,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/File/InitiateFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnInitiateFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InitiateFileUploadsResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/File/InitiateFileUploads", std::move(requestJson), DispatchResult<InitiateFileUploadsResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InitiateFileUploadsResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnInitiateFileUploadsResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::InviteToGroup(
+        InviteToGroupRequest& request,
+        ProcessApiCallback<InviteToGroupResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        InitiateFileUploadsResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<InitiateFileUploadsResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        InviteToGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::InviteToGroup(
+        PlayFabContext& context,
         InviteToGroupRequest& request,
         ProcessApiCallback<InviteToGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -579,26 +511,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/InviteToGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnInviteToGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InviteToGroupResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/InviteToGroup", std::move(requestJson), DispatchResult<InviteToGroupResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InviteToGroupResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnInviteToGroupResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::IsMember(
+        IsMemberRequest& request,
+        ProcessApiCallback<IsMemberResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        InviteToGroupResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<InviteToGroupResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IsMember(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::IsMember(
+        PlayFabContext& context,
         IsMemberRequest& request,
         ProcessApiCallback<IsMemberResponse> callback,
         ErrorCallback errorCallback,
@@ -606,26 +534,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/IsMember", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnIsMemberResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IsMemberResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/IsMember", std::move(requestJson), DispatchResult<IsMemberResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IsMemberResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnIsMemberResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ListGroupApplications(
+        ListGroupApplicationsRequest& request,
+        ProcessApiCallback<ListGroupApplicationsResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        IsMemberResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<IsMemberResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ListGroupApplications(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ListGroupApplications(
+        PlayFabContext& context,
         ListGroupApplicationsRequest& request,
         ProcessApiCallback<ListGroupApplicationsResponse> callback,
         ErrorCallback errorCallback,
@@ -633,26 +557,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupApplications", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupApplicationsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupApplicationsResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ListGroupApplications", std::move(requestJson), DispatchResult<ListGroupApplicationsResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupApplicationsResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnListGroupApplicationsResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ListGroupBlocks(
+        ListGroupBlocksRequest& request,
+        ProcessApiCallback<ListGroupBlocksResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListGroupApplicationsResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListGroupApplicationsResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ListGroupBlocks(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ListGroupBlocks(
+        PlayFabContext& context,
         ListGroupBlocksRequest& request,
         ProcessApiCallback<ListGroupBlocksResponse> callback,
         ErrorCallback errorCallback,
@@ -660,26 +580,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupBlocks", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupBlocksResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupBlocksResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ListGroupBlocks", std::move(requestJson), DispatchResult<ListGroupBlocksResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupBlocksResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnListGroupBlocksResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ListGroupInvitations(
+        ListGroupInvitationsRequest& request,
+        ProcessApiCallback<ListGroupInvitationsResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListGroupBlocksResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListGroupBlocksResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ListGroupInvitations(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ListGroupInvitations(
+        PlayFabContext& context,
         ListGroupInvitationsRequest& request,
         ProcessApiCallback<ListGroupInvitationsResponse> callback,
         ErrorCallback errorCallback,
@@ -687,26 +603,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupInvitations", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupInvitationsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupInvitationsResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ListGroupInvitations", std::move(requestJson), DispatchResult<ListGroupInvitationsResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupInvitationsResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnListGroupInvitationsResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ListGroupMembers(
+        ListGroupMembersRequest& request,
+        ProcessApiCallback<ListGroupMembersResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListGroupInvitationsResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListGroupInvitationsResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ListGroupMembers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ListGroupMembers(
+        PlayFabContext& context,
         ListGroupMembersRequest& request,
         ProcessApiCallback<ListGroupMembersResponse> callback,
         ErrorCallback errorCallback,
@@ -714,26 +626,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupMembersResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ListGroupMembers", std::move(requestJson), DispatchResult<ListGroupMembersResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupMembersResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnListGroupMembersResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ListMembership(
+        ListMembershipRequest& request,
+        ProcessApiCallback<ListMembershipResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListGroupMembersResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListGroupMembersResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ListMembership(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ListMembership(
+        PlayFabContext& context,
         ListMembershipRequest& request,
         ProcessApiCallback<ListMembershipResponse> callback,
         ErrorCallback errorCallback,
@@ -741,26 +649,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListMembership", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListMembershipResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ListMembership", std::move(requestJson), DispatchResult<ListMembershipResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnListMembershipResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::ListMembershipOpportunities(
+        ListMembershipOpportunitiesRequest& request,
+        ProcessApiCallback<ListMembershipOpportunitiesResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListMembershipResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListMembershipResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ListMembershipOpportunities(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::ListMembershipOpportunities(
+        PlayFabContext& context,
         ListMembershipOpportunitiesRequest& request,
         ProcessApiCallback<ListMembershipOpportunitiesResponse> callback,
         ErrorCallback errorCallback,
@@ -768,26 +672,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListMembershipOpportunities", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListMembershipOpportunitiesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipOpportunitiesResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/ListMembershipOpportunities", std::move(requestJson), DispatchResult<ListMembershipOpportunitiesResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipOpportunitiesResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnListMembershipOpportunitiesResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::RemoveGroupApplication(
+        RemoveGroupApplicationRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListMembershipOpportunitiesResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListMembershipOpportunitiesResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemoveGroupApplication(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::RemoveGroupApplication(
+        PlayFabContext& context,
         RemoveGroupApplicationRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -795,26 +695,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/RemoveGroupApplication", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveGroupApplicationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/RemoveGroupApplication", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnRemoveGroupApplicationResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::RemoveGroupInvitation(
+        RemoveGroupInvitationRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemoveGroupInvitation(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::RemoveGroupInvitation(
+        PlayFabContext& context,
         RemoveGroupInvitationRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -822,26 +718,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/RemoveGroupInvitation", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveGroupInvitationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/RemoveGroupInvitation", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnRemoveGroupInvitationResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::RemoveMembers(
+        RemoveMembersRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemoveMembers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::RemoveMembers(
+        PlayFabContext& context,
         RemoveMembersRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -849,26 +741,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/RemoveMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/RemoveMembers", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnRemoveMembersResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::SetGlobalPolicy(
+        SetGlobalPolicyRequest& request,
+        ProcessApiCallback<SetGlobalPolicyResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetGlobalPolicy(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::SetGlobalPolicy(
+        PlayFabContext& context,
         SetGlobalPolicyRequest& request,
         ProcessApiCallback<SetGlobalPolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -876,26 +764,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/SetGlobalPolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetGlobalPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGlobalPolicyResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Profile/SetGlobalPolicy", std::move(requestJson), DispatchResult<SetGlobalPolicyResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGlobalPolicyResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnSetGlobalPolicyResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::SetObjects(
+        SetObjectsRequest& request,
+        ProcessApiCallback<SetObjectsResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetGlobalPolicyResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetGlobalPolicyResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetObjects(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::SetObjects(
+        PlayFabContext& context,
         SetObjectsRequest& request,
         ProcessApiCallback<SetObjectsResponse> callback,
         ErrorCallback errorCallback,
@@ -903,26 +787,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Object/SetObjects", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetObjectsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetObjectsResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Object/SetObjects", std::move(requestJson), DispatchResult<SetObjectsResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetObjectsResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnSetObjectsResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::SetProfilePolicy(
+        SetEntityProfilePolicyRequest& request,
+        ProcessApiCallback<SetEntityProfilePolicyResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetObjectsResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetObjectsResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetProfilePolicy(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::SetProfilePolicy(
+        PlayFabContext& context,
         SetEntityProfilePolicyRequest& request,
         ProcessApiCallback<SetEntityProfilePolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -930,26 +810,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/SetProfilePolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetProfilePolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetEntityProfilePolicyResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Profile/SetProfilePolicy", std::move(requestJson), DispatchResult<SetEntityProfilePolicyResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetEntityProfilePolicyResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnSetProfilePolicyResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::UnblockEntity(
+        UnblockEntityRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetEntityProfilePolicyResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetEntityProfilePolicyResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnblockEntity(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::UnblockEntity(
+        PlayFabContext& context,
         UnblockEntityRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -957,26 +833,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/UnblockEntity", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUnblockEntityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/UnblockEntity", std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnUnblockEntityResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::UpdateGroup(
+        UpdateGroupRequest& request,
+        ProcessApiCallback<UpdateGroupResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::UpdateGroup(
+        PlayFabContext& context,
         UpdateGroupRequest& request,
         ProcessApiCallback<UpdateGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -984,26 +856,22 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/UpdateGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUpdateGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/UpdateGroup", std::move(requestJson), DispatchResult<UpdateGroupResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnUpdateGroupResult(CallRequestContainer& request)
+    void PlayFabEntityAPI::UpdateRole(
+        UpdateGroupRoleRequest& request,
+        ProcessApiCallback<UpdateGroupRoleResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateGroupResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateGroupResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateRole(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabEntityAPI::UpdateRole(
+        PlayFabContext& context,
         UpdateGroupRoleRequest& request,
         ProcessApiCallback<UpdateGroupRoleResponse> callback,
         ErrorCallback errorCallback,
@@ -1011,23 +879,14 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/UpdateRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUpdateRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupRoleResponse>(callback)), errorCallback, customData);
+        auto requestJson = request.ToJson();
+        context.AddEntityRequest("/Group/UpdateRole", std::move(requestJson), DispatchResult<UpdateGroupRoleResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupRoleResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabEntityAPI::OnUpdateRoleResult(CallRequestContainer& request)
+    // Results the API keeps something from, before passing them on
+    void PlayFabEntityAPI::OnGetEntityTokenResult(CallRequestContainer& request, const GetEntityTokenResponse& outResult)
     {
-        UpdateGroupRoleResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateGroupRoleResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        if (outResult.EntityToken.length() > 0) request.context->SetEntityToken(outResult.EntityToken, outResult.TokenExpiration);
     }
 }
 
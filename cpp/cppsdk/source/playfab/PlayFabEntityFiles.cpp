@@ -0,0 +1,508 @@
+#include <gsdkCommonPch.h>
+
+#ifdef ENABLE_PLAYFABENTITY_API
+
+#include <playfab/PlayFabEntityFiles.h>
+#include <playfab/PlayFabSettings.h>
+#include <gsdkUtils.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef GSDK_LINUX
+#include <unistd.h>
+#else
+#include <io.h>
+#include <share.h>
+#include <system_error>
+#endif
+
+namespace PlayFab
+{
+    using namespace EntityModels;
+
+    namespace
+    {
+        struct MappedFileReader
+        {
+            const char* data;
+            size_t size;
+            size_t offset;
+        };
+
+        struct RangeWriter
+        {
+            CURL* curlHandle;
+            int fd;
+            size_t offset; // Where the next byte goes, which is where a failed attempt resumes from
+            size_t end; // One past the last byte that was asked for
+            bool ranged;
+            bool checkedResponse;
+            bool rangeIgnored;
+        };
+
+#ifdef GSDK_LINUX
+        int OpenForWriting(const std::string& path)
+        {
+            return open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        }
+
+        bool SetFileSize(int fd, size_t size)
+        {
+            return ftruncate(fd, static_cast<off_t>(size)) == 0;
+        }
+
+        // Writes at an explicit offset rather than the file position, so ranges can be written from several threads at once
+        bool WriteAt(int fd, const char* data, size_t count, size_t offset)
+        {
+            while (count > 0)
+            {
+                const ssize_t result = pwrite(fd, data, count, static_cast<off_t>(offset));
+                if (result < 0)
+                    return false;
+                data += result;
+                count -= static_cast<size_t>(result);
+                offset += static_cast<size_t>(result);
+            }
+            return true;
+        }
+
+        void CloseFile(int fd)
+        {
+            close(fd);
+        }
+
+        void RemoveFile(const std::string& path)
+        {
+            unlink(path.c_str());
+        }
+
+        std::string LastFileError()
+        {
+            return strerror(errno);
+        }
+#else
+        int OpenForWriting(const std::string& path)
+        {
+            int fd = -1;
+            _sopen_s(&fd, path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+            return fd;
+        }
+
+        bool SetFileSize(int fd, size_t size)
+        {
+            return _chsize_s(fd, static_cast<__int64>(size)) == 0;
+        }
+
+        // The Windows counterpart of pwrite: the offset in the OVERLAPPED picks where each write lands, whatever the file position is
+        bool WriteAt(int fd, const char* data, size_t count, size_t offset)
+        {
+            const HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+            while (count > 0)
+            {
+                OVERLAPPED overlapped = {};
+                overlapped.Offset = static_cast<DWORD>(offset);
+                overlapped.OffsetHigh = static_cast<DWORD>(static_cast<unsigned long long>(offset) >> 32);
+                DWORD written = 0;
+                if (!WriteFile(file, data, static_cast<DWORD>((std::min)(count, static_cast<size_t>(MAXDWORD))), &written, &overlapped))
+                    return false;
+                data += written;
+                count -= written;
+                offset += written;
+            }
+            return true;
+        }
+
+        void CloseFile(int fd)
+        {
+            _close(fd);
+        }
+
+        void RemoveFile(const std::string& path)
+        {
+            _unlink(path.c_str());
+        }
+
+        std::string LastFileError()
+        {
+            return std::generic_category().message(errno);
+        }
+#endif
+
+        // Hands curl the next part of the mapped file, so the file is only ever copied into curl's send buffer
+        size_t ReadMappedFile(char* buffer, size_t blockSize, size_t blockCount, void* userData)
+        {
+            MappedFileReader* reader = reinterpret_cast<MappedFileReader*>(userData);
+            const size_t count = (std::min)(blockSize * blockCount, reader->size - reader->offset);
+            memcpy(buffer, reader->data + reader->offset, count);
+            reader->offset += count;
+            return count;
+        }
+
+        size_t WriteRange(char* buffer, size_t blockSize, size_t blockCount, void* userData)
+        {
+            RangeWriter* writer = reinterpret_cast<RangeWriter*>(userData);
+            const size_t count = blockSize * blockCount;
+
+            if (!writer->checkedResponse)
+            {
+                // A server that ignores the Range header sends the file from the start, which must not be written at this offset
+                long httpCode = 0;
+                curl_easy_getinfo(writer->curlHandle, CURLINFO_RESPONSE_CODE, &httpCode);
+                writer->checkedResponse = true;
+                writer->rangeIgnored = writer->ranged && httpCode != 206;
+            }
+            if (writer->rangeIgnored || count > writer->end - writer->offset)
+                return 0; // Aborts the transfer
+
+            if (!WriteAt(writer->fd, buffer, count, writer->offset))
+                return 0;
+
+            writer->offset += count;
+            return count;
+        }
+    }
+
+    PlayFabFileTransferSettings PlayFabEntityFiles::transferSettings;
+    std::mutex PlayFabEntityFiles::transfersMutex;
+    std::vector<std::future<void>> PlayFabEntityFiles::transfers;
+
+    void PlayFabEntityFiles::UploadFiles(const EntityKey& entity, const std::vector<PlayFabFileUpload>& files, ProcessApiCallback<FinalizeFileUploadsResponse> callback, ErrorCallback errorCallback, void* customData)
+    {
+        const PlayFabFileTransferSettings settings = transferSettings;
+
+        InitiateFileUploadsRequest request;
+        request.Entity = entity;
+        for (const auto& file : files)
+            request.FileNames.push_back(file.fileName);
+
+        PlayFabEntityAPI::InitiateFileUploads(request,
+            [entity, files, settings, callback, errorCallback](const InitiateFileUploadsResponse& result, void* customData)
+            {
+                std::map<std::string, std::string> uploadUrls;
+                for (const auto& details : result.UploadDetails)
+                    uploadUrls[details.FileName] = details.UploadUrl;
+
+                StartTransfer([=]() { RunUploads(entity, files, uploadUrls, settings, callback, errorCallback, customData); });
+            },
+            errorCallback, customData);
+    }
+
+    void PlayFabEntityFiles::DownloadFile(const EntityKey& entity, const std::string& fileName, const std::string& localPath, ProcessApiCallback<GetFileMetadata> callback, ErrorCallback errorCallback, void* customData)
+    {
+        const PlayFabFileTransferSettings settings = transferSettings;
+
+        GetFilesRequest request;
+        request.Entity = entity;
+
+        PlayFabEntityAPI::GetFiles(request,
+            [fileName, localPath, settings, callback, errorCallback](const GetFilesResponse& result, void* customData)
+            {
+                const auto metadata = result.Metadata.find(fileName);
+                if (metadata == result.Metadata.end())
+                {
+                    PlayFabError error;
+                    error.HttpCode = 404;
+                    error.HttpStatus = "NotFound";
+                    error.ErrorCode = PlayFabErrorFileNotFound;
+                    error.ErrorName = "FileNotFound";
+                    error.ErrorMessage = "The entity has no file named " + fileName;
+                    ReportError(error, errorCallback, customData);
+                    return;
+                }
+
+                const GetFileMetadata fileMetadata = metadata->second;
+                StartTransfer([=]() { RunDownload(fileMetadata, localPath, settings, callback, errorCallback, customData); });
+            },
+            errorCallback, customData);
+    }
+
+    void PlayFabEntityFiles::WaitForTransfers()
+    {
+        while (true)
+        {
+            std::vector<std::future<void>> toWaitFor;
+
+            { // LOCK transfersMutex
+                std::unique_lock<std::mutex> lock(transfersMutex);
+                toWaitFor.swap(transfers);
+            } // UNLOCK transfersMutex
+
+            if (toWaitFor.empty())
+                return;
+
+            for (auto& transfer : toWaitFor)
+                transfer.wait();
+        }
+    }
+
+    void PlayFabEntityFiles::StartTransfer(std::function<void()> transfer)
+    {
+        std::unique_lock<std::mutex> lock(transfersMutex);
+
+        // Forget the transfers that have completed since the last one started
+        transfers.erase(std::remove_if(transfers.begin(), transfers.end(), [](const std::future<void>& existing)
+        {
+            return existing.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }), transfers.end());
+
+        transfers.push_back(std::async(std::launch::async, std::move(transfer)));
+    }
+
+    void PlayFabEntityFiles::RunUploads(EntityKey entity, std::vector<PlayFabFileUpload> files, std::map<std::string, std::string> uploadUrls, PlayFabFileTransferSettings settings, ProcessApiCallback<FinalizeFileUploadsResponse> callback, ErrorCallback errorCallback, void* customData)
+    {
+        for (const auto& file : files)
+        {
+            PlayFabError error;
+            bool uploaded = false;
+            const auto uploadUrl = uploadUrls.find(file.fileName);
+            if (uploadUrl == uploadUrls.end())
+                error = MakeTransferError("", CURLE_OK, 0, "No upload URL was returned for " + file.fileName);
+            else
+                uploaded = UploadFile(uploadUrl->second, file.localPath, settings, error);
+
+            if (!uploaded)
+            {
+                // Release the pending uploads so the files can be uploaded again straight away
+                AbortFileUploadsRequest abortRequest;
+                abortRequest.Entity = entity;
+                for (const auto& abortedFile : files)
+                    abortRequest.FileNames.push_back(abortedFile.fileName);
+                PlayFabEntityAPI::AbortFileUploads(abortRequest, nullptr);
+
+                ReportError(error, errorCallback, customData);
+                return;
+            }
+        }
+
+        FinalizeFileUploadsRequest finalizeRequest;
+        finalizeRequest.Entity = entity;
+        for (const auto& file : files)
+            finalizeRequest.FileNames.push_back(file.fileName);
+        PlayFabEntityAPI::FinalizeFileUploads(finalizeRequest, callback, errorCallback, customData);
+    }
+
+    void PlayFabEntityFiles::RunDownload(GetFileMetadata metadata, std::string localPath, PlayFabFileTransferSettings settings, ProcessApiCallback<GetFileMetadata> callback, ErrorCallback errorCallback, void* customData)
+    {
+        const int fd = OpenForWriting(localPath);
+        if (fd < 0)
+        {
+            ReportError(MakeTransferError(metadata.DownloadUrl, CURLE_WRITE_ERROR, 0, "Failed to open " + localPath + ": " + LastFileError()), errorCallback, customData);
+            return;
+        }
+
+        const size_t fileSize = metadata.Size > 0 ? static_cast<size_t>(metadata.Size) : 0;
+        const size_t chunkSize = (std::max)(settings.downloadChunkSize, static_cast<size_t>(1));
+        PlayFabError error;
+        bool downloaded;
+
+        if (fileSize <= chunkSize)
+        {
+            downloaded = DownloadRange(metadata.DownloadUrl, fd, { 0, SIZE_MAX - 1 }, false, settings.maxBytesPerSecond, settings, error);
+        }
+        else if (!SetFileSize(fd, fileSize))
+        {
+            error = MakeTransferError(metadata.DownloadUrl, CURLE_WRITE_ERROR, 0, "Failed to allocate " + localPath + ": " + LastFileError());
+            downloaded = false;
+        }
+        else
+        {
+            const size_t chunkCount = (fileSize + chunkSize - 1) / chunkSize;
+            const size_t workerCount = (std::min)((std::max)(settings.maxParallelChunks, static_cast<size_t>(1)), chunkCount);
+            // Split the cap between the ranges in flight so the download as a whole stays under it
+            const size_t bytesPerSecondPerWorker = settings.maxBytesPerSecond == 0 ? 0 : (std::max)(settings.maxBytesPerSecond / workerCount, static_cast<size_t>(1));
+
+            std::atomic<size_t> nextChunk(0);
+            std::atomic<bool> failed(false);
+            std::mutex errorMutex;
+
+            auto downloadChunks = [&]()
+            {
+                while (!failed)
+                {
+                    const size_t chunk = nextChunk++;
+                    if (chunk >= chunkCount)
+                        return;
+
+                    const ByteRange range = { chunk * chunkSize, (std::min)(fileSize, (chunk + 1) * chunkSize) - 1 };
+                    PlayFabError chunkError;
+                    if (!DownloadRange(metadata.DownloadUrl, fd, range, true, bytesPerSecondPerWorker, settings, chunkError))
+                    {
+                        std::unique_lock<std::mutex> lock(errorMutex);
+                        if (!failed.exchange(true))
+                            error = chunkError;
+                    }
+                }
+            };
+
+            std::vector<std::thread> workers;
+            for (size_t i = 1; i < workerCount; ++i)
+                workers.emplace_back(downloadChunks);
+            downloadChunks();
+            for (auto& worker : workers)
+                worker.join();
+
+            downloaded = !failed;
+        }
+
+        CloseFile(fd);
+
+        if (downloaded)
+        {
+            if (callback != nullptr)
+                callback(metadata, customData);
+        }
+        else
+        {
+            RemoveFile(localPath);
+            ReportError(error, errorCallback, customData);
+        }
+    }
+
+    bool PlayFabEntityFiles::UploadFile(const std::string& uploadUrl, const std::string& localPath, const PlayFabFileTransferSettings& settings, PlayFabError& outError)
+    {
+        const Microsoft::Azure::Gaming::cMappedFile file(localPath);
+        if (!file.isOpen())
+        {
+            outError = MakeTransferError(uploadUrl, CURLE_READ_ERROR, 0, "Failed to open " + localPath);
+            return false;
+        }
+
+        bool uploaded = false;
+        for (unsigned int attempt = 1; !uploaded; ++attempt)
+        {
+            // The upload URL takes the blob in one PUT, so a failed upload is sent again from the start
+            MappedFileReader reader = { file.data(), file.size(), 0 };
+
+            CURL* curlHandle = curl_easy_init();
+            SetCommonOptions(curlHandle, uploadUrl, settings);
+
+            curl_slist* curlHttpHeaders = nullptr;
+            curlHttpHeaders = curl_slist_append(curlHttpHeaders, "Content-Type: application/octet-stream");
+            curlHttpHeaders = curl_slist_append(curlHttpHeaders, "x-ms-blob-type: BlockBlob");
+            curl_easy_setopt(curlHandle, CURLOPT_HTTPHEADER, curlHttpHeaders);
+
+            curl_easy_setopt(curlHandle, CURLOPT_UPLOAD, 1L);
+            curl_easy_setopt(curlHandle, CURLOPT_READFUNCTION, ReadMappedFile);
+            curl_easy_setopt(curlHandle, CURLOPT_READDATA, &reader);
+            curl_easy_setopt(curlHandle, CURLOPT_INFILESIZE_LARGE, static_cast<curl_off_t>(file.size()));
+            if (settings.maxBytesPerSecond != 0)
+                curl_easy_setopt(curlHandle, CURLOPT_MAX_SEND_SPEED_LARGE, static_cast<curl_off_t>(settings.maxBytesPerSecond));
+
+            const CURLcode result = curl_easy_perform(curlHandle);
+            long httpCode = 0;
+            curl_easy_getinfo(curlHandle, CURLINFO_RESPONSE_CODE, &httpCode);
+            curl_easy_cleanup(curlHandle);
+            curl_slist_free_all(curlHttpHeaders);
+
+            if (result == CURLE_OK)
+            {
+                uploaded = true;
+            }
+            else
+            {
+                outError = MakeTransferError(uploadUrl, result, httpCode, "Failed to upload " + localPath);
+                if (!outError.IsTransient() || attempt >= settings.maxAttempts)
+                    break;
+            }
+        }
+
+        return uploaded;
+    }
+
+    bool PlayFabEntityFiles::DownloadRange(const std::string& downloadUrl, int fd, ByteRange range, bool ranged, size_t maxBytesPerSecond, const PlayFabFileTransferSettings& settings, PlayFabError& outError)
+    {
+        RangeWriter writer = { nullptr, fd, range.first, range.last + 1, ranged, false, false };
+
+        for (unsigned int attempt = 1; ; ++attempt)
+        {
+            CURL* curlHandle = curl_easy_init();
+            SetCommonOptions(curlHandle, downloadUrl, settings);
+
+            // Later attempts pick up from the last byte that was written, which needs a range even when the first attempt did not
+            writer.curlHandle = curlHandle;
+            writer.checkedResponse = false;
+            writer.ranged = ranged || writer.offset != range.first;
+            std::string byteRange;
+            if (writer.ranged)
+            {
+                byteRange = std::to_string(writer.offset) + "-";
+                if (ranged)
+                    byteRange += std::to_string(range.last);
+                curl_easy_setopt(curlHandle, CURLOPT_RANGE, byteRange.c_str());
+            }
+
+            curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, WriteRange);
+            curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &writer);
+            if (maxBytesPerSecond != 0)
+                curl_easy_setopt(curlHandle, CURLOPT_MAX_RECV_SPEED_LARGE, static_cast<curl_off_t>(maxBytesPerSecond));
+
+            const CURLcode result = curl_easy_perform(curlHandle);
+            long httpCode = 0;
+            curl_easy_getinfo(curlHandle, CURLINFO_RESPONSE_CODE, &httpCode);
+            curl_easy_cleanup(curlHandle);
+
+            if (result == CURLE_OK && (!ranged || writer.offset == writer.end))
+                return true;
+
+            if (writer.rangeIgnored)
+            {
+                outError = MakeTransferError(downloadUrl, result, 416, "The server does not support ranged downloads");
+                return false;
+            }
+
+            outError = MakeTransferError(downloadUrl, result == CURLE_OK ? CURLE_PARTIAL_FILE : result, httpCode, "Failed to download bytes " + std::to_string(writer.offset) + "-" + (ranged ? std::to_string(range.last) : std::string()));
+            if (!outError.IsTransient() || attempt >= settings.maxAttempts)
+                return false;
+        }
+    }
+
+    void PlayFabEntityFiles::SetCommonOptions(CURL* curlHandle, const std::string& url, const PlayFabFileTransferSettings& settings)
+    {
+        curl_easy_setopt(curlHandle, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(curlHandle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_FAILONERROR, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_LOW_SPEED_LIMIT, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_LOW_SPEED_TIME, settings.lowSpeedTimeoutSeconds);
+    }
+
+    void PlayFabEntityFiles::ReportError(const PlayFabError& error, ErrorCallback errorCallback, void* customData)
+    {
+        if (PlayFabSettings::globalErrorHandler != nullptr)
+            PlayFabSettings::globalErrorHandler(error, customData);
+        if (errorCallback != nullptr)
+            errorCallback(error, customData);
+    }
+
+    PlayFabError PlayFabEntityFiles::MakeTransferError(const std::string& url, CURLcode result, long httpCode, const std::string& message)
+    {
+        PlayFabError error;
+        // Upload and download URLs are signed, so keep the signature out of anything that might get logged
+        error.UrlPath = url.substr(0, url.find('?'));
+        error.ErrorName = "File transfer failed";
+        if (httpCode >= 400)
+        {
+            error.HttpCode = static_cast<int>(httpCode);
+            error.HttpStatus = "HTTP " + std::to_string(httpCode);
+            error.ErrorCode = httpCode >= 500 ? PlayFabErrorServiceUnavailable : PlayFabErrorUnknownError;
+            error.ErrorMessage = message;
+        }
+        else if (result == CURLE_OK || result == CURLE_READ_ERROR || result == CURLE_WRITE_ERROR)
+        {
+            // Failures on this side (local files, missing URLs) would only fail the same way again
+            error.HttpCode = 0;
+            error.HttpStatus = "File transfer failed";
+            error.ErrorCode = PlayFabErrorUnknownError;
+            error.ErrorMessage = message;
+        }
+        else
+        {
+            error.HttpCode = 408;
+            error.HttpStatus = "Failed to contact server";
+            error.ErrorCode = PlayFabErrorConnectionTimeout;
+            error.ErrorMessage = message + ", curl error: " + curl_easy_strerror(result);
+        }
+        return error;
+    }
+}
+
+#endif
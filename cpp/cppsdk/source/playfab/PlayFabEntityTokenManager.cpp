@@ -0,0 +1,180 @@
+#include <gsdkCommonPch.h>
+
+#include <playfab/PlayFabEntityTokenManager.h>
+
+#ifdef ENABLE_PLAYFABENTITY_API
+#include <playfab/PlayFabEntityApi.h>
+#endif
+
+namespace PlayFab
+{
+    std::shared_ptr<const PlayFabEntityTokenManager::EntityToken> PlayFabEntityTokenManager::currentToken = std::make_shared<const EntityToken>();
+
+    std::shared_ptr<const PlayFabEntityTokenManager::EntityToken> PlayFabEntityTokenManager::GetToken()
+    {
+        return std::atomic_load(&currentToken);
+    }
+
+    void PlayFabEntityTokenManager::SetToken(const std::string& token, time_t expiration)
+    {
+        std::atomic_store(&currentToken, std::shared_ptr<const EntityToken>(new EntityToken{ token, expiration }));
+
+#ifdef ENABLE_PLAYFABENTITY_API
+        // The refresh thread has to reschedule for the new expiration. Taking the lock makes sure it is not between checking the token and waiting.
+        { // LOCK refreshMutex
+            std::unique_lock<std::mutex> lock(refreshMutex);
+        } // UNLOCK refreshMutex
+        refreshCondition.notify_all();
+#endif
+    }
+
+    void PlayFabEntityTokenManager::SetToken(const std::string& token, const Boxed<time_t>& expiration)
+    {
+        SetToken(token, expiration.notNull() ? expiration.mValue : 0);
+    }
+
+    void PlayFabEntityTokenManager::ClearToken()
+    {
+        SetToken(std::string(), 0);
+    }
+
+#ifdef ENABLE_PLAYFABENTITY_API
+    // A failed refresh is retried after this long, unless something asks for one sooner
+    constexpr std::chrono::seconds c_refreshRetryDelay(30);
+
+    std::mutex PlayFabEntityTokenManager::refreshMutex;
+    std::condition_variable PlayFabEntityTokenManager::refreshCondition;
+    std::thread PlayFabEntityTokenManager::refreshThread;
+    bool PlayFabEntityTokenManager::refreshThreadRunning = false;
+    bool PlayFabEntityTokenManager::refreshInFlight = false;
+    std::chrono::steady_clock::time_point PlayFabEntityTokenManager::retryAfter;
+    std::deque<PlayFabEntityTokenManager::HeldRequest> PlayFabEntityTokenManager::heldRequests;
+    EntityModels::GetEntityTokenRequest PlayFabEntityTokenManager::refreshRequest;
+    unsigned int PlayFabEntityTokenManager::refreshMarginSeconds = 300;
+
+    void PlayFabEntityTokenManager::Start(const EntityModels::GetEntityTokenRequest& tokenRequest, unsigned int refreshBeforeExpirySeconds)
+    {
+        { // LOCK refreshMutex
+            std::unique_lock<std::mutex> lock(refreshMutex);
+            refreshRequest = tokenRequest;
+            refreshMarginSeconds = refreshBeforeExpirySeconds;
+
+            if (!refreshThreadRunning)
+            {
+                refreshThreadRunning = true;
+                refreshThread = std::thread(&PlayFabEntityTokenManager::RefreshThread);
+            }
+        } // UNLOCK refreshMutex
+
+        // Without an expiration there is nothing to schedule the refreshes from
+        if (GetToken()->expiration == 0)
+            Refresh();
+    }
+
+    void PlayFabEntityTokenManager::Stop()
+    {
+        { // LOCK refreshMutex
+            std::unique_lock<std::mutex> lock(refreshMutex);
+            refreshThreadRunning = false;
+        } // UNLOCK refreshMutex
+
+        refreshCondition.notify_all();
+        if (refreshThread.joinable())
+            refreshThread.join();
+    }
+
+    void PlayFabEntityTokenManager::Refresh()
+    {
+        EntityModels::GetEntityTokenRequest request;
+
+        { // LOCK refreshMutex
+            std::unique_lock<std::mutex> lock(refreshMutex);
+            if (refreshInFlight)
+                return;
+            refreshInFlight = true;
+            request = refreshRequest;
+        } // UNLOCK refreshMutex
+
+        // OnGetEntityTokenResult stores the new token before these run
+        PlayFabEntityAPI::GetEntityToken(request,
+            [](const EntityModels::GetEntityTokenResponse&, void*) { OnRefreshComplete(true); },
+            [](const PlayFabError&, void*) { OnRefreshComplete(false); });
+    }
+
+    bool PlayFabEntityTokenManager::IsRefreshing()
+    {
+        std::unique_lock<std::mutex> lock(refreshMutex);
+        return refreshInFlight;
+    }
+
+    void PlayFabEntityTokenManager::AddRequest(const std::string& urlPath, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData)
+    {
+        { // LOCK refreshMutex
+            std::unique_lock<std::mutex> lock(refreshMutex);
+            if (refreshInFlight)
+            {
+                heldRequests.push_back(HeldRequest{ urlPath, std::move(requestBody), internalCallback, successCallback, errorCallback, customData, Microsoft::Azure::Gaming::GSDKTrace::getCurrentContext() });
+                return;
+            }
+        } // UNLOCK refreshMutex
+
+        IPlayFabHttp::Get().AddRequest(urlPath, "X-EntityToken", GetToken()->token, std::move(requestBody), internalCallback, successCallback, errorCallback, customData);
+    }
+
+    void PlayFabEntityTokenManager::RefreshThread()
+    {
+        std::unique_lock<std::mutex> lock(refreshMutex);
+
+        while (refreshThreadRunning)
+        {
+            const auto token = GetToken();
+            if (refreshInFlight || (token->expiration == 0 && !token->token.empty()))
+            {
+                // Woken when the refresh completes or a token with an expiration is set
+                refreshCondition.wait(lock);
+                continue;
+            }
+
+            // Expirations are wall-clock times, so convert the refresh time to the steady clock for waiting
+            const auto untilRefresh = std::chrono::system_clock::from_time_t(token->expiration) - std::chrono::seconds(refreshMarginSeconds) - std::chrono::system_clock::now();
+            auto refreshTime = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(untilRefresh);
+            if (refreshTime < retryAfter)
+                refreshTime = retryAfter;
+
+            if (std::chrono::steady_clock::now() < refreshTime)
+            {
+                refreshCondition.wait_until(lock, refreshTime);
+                continue;
+            }
+
+            lock.unlock();
+            Refresh();
+            lock.lock();
+        }
+    }
+
+    void PlayFabEntityTokenManager::OnRefreshComplete(bool succeeded)
+    {
+        std::deque<HeldRequest> toSend;
+
+        { // LOCK refreshMutex
+            std::unique_lock<std::mutex> lock(refreshMutex);
+            refreshInFlight = false;
+            if (!succeeded)
+                retryAfter = std::chrono::steady_clock::now() + c_refreshRetryDelay;
+            toSend.swap(heldRequests);
+        } // UNLOCK refreshMutex
+
+        refreshCondition.notify_all();
+
+        // A failed refresh happens ahead of the expiration, so the current token is still the best one to send these with
+        const auto token = GetToken();
+        IPlayFabHttp& http = IPlayFabHttp::Get();
+        for (auto& held : toSend)
+        {
+            Microsoft::Azure::Gaming::ScopedTraceContext scopedTraceContext(held.traceContext);
+            http.AddRequest(held.urlPath, "X-EntityToken", token->token, std::move(held.requestBody), held.internalCallback, held.successCallback, held.errorCallback, held.customData);
+        }
+    }
+#endif
+}
@@ -60,4 +60,9 @@ namespace PlayFab
         }
         return output;
     }
+
+    bool PlayFabError::IsTransient() const
+    {
+        return HttpCode == 408 || HttpCode == 429 || HttpCode >= 500;
+    }
 }
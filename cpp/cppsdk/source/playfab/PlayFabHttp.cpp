@@ -2,14 +2,22 @@
 
 #include <playfab/PlayFabHttp.h>
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabContext.h>
 #include <exception>
 
+#ifdef GSDK_LINUX
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
 namespace PlayFab
 {
     CallRequestContainer::CallRequestContainer() :
-        curlHandle(nullptr),
         curlHttpHeaders(nullptr),
+        curlHttpHeadersTail(nullptr),
+        curlHandle(nullptr),
         customData(nullptr),
+        context(nullptr),
         finished(false),
         responseString(""),
         responseJson(Json::Value::null),
@@ -22,67 +30,169 @@ namespace PlayFab
 
     CallRequestContainer::~CallRequestContainer()
     {
-        curl_easy_reset(curlHandle);
-        curlHttpHeaders = nullptr;
+        // Unlinks the shared static headers, which are not mine to free
+        if (curlHttpHeadersTail != nullptr)
+            curlHttpHeadersTail->next = nullptr;
+        curl_slist_free_all(curlHttpHeaders);
     }
 
     std::unique_ptr<IPlayFabHttp> IPlayFabHttp::httpInstance = nullptr;
+    std::once_flag IPlayFabHttp::httpInstanceCreated;
     IPlayFabHttp::~IPlayFabHttp() = default;
     IPlayFabHttp& IPlayFabHttp::Get()
     {
         // In the future we could make it easier to override this instance with a sub-type, for now it defaults to the only one we have
-        if (httpInstance == nullptr)
-            PlayFabHttp::MakeInstance();
+        PlayFabHttp::MakeInstance();
         return *httpInstance.get();
     }
 
-    PlayFabHttp::PlayFabHttp()
+    size_t IPlayFabHttp::WarmConnections(size_t)
+    {
+        return 0;
+    }
+
+    size_t IPlayFabHttp::UpdateBatch(size_t maxResults)
+    {
+        size_t handled = 0;
+        while (handled < maxResults && Update() != 0)
+            ++handled;
+        return handled;
+    }
+
+    int IPlayFabHttp::GetResultEventFd()
+    {
+        return -1;
+    }
+
+    std::map<std::string, PlayFabCallbackMetrics> IPlayFabHttp::GetCallbackMetrics()
+    {
+        return std::map<std::string, PlayFabCallbackMetrics>();
+    }
+
+    PlayFabHttp::PlayFabHttp(PlayFabContext& context, size_t workerCount) :
+        context(context),
+        staticHeaders(nullptr),
+        resultEventFd(-1),
+        warmRound(0),
+        warmSlotsLeft(0),
+        warmFinished(0),
+        warmSucceeded(0),
+        callbackThreadsRunning(false)
     {
+#ifdef GSDK_LINUX
+        resultEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+
+        // curl_easy_init is only thread-safe once the global state exists, and every worker calls it
+        curl_global_init(CURL_GLOBAL_DEFAULT);
+
+        curlShare = curl_share_init();
+        curl_share_setopt(curlShare, CURLSHOPT_LOCKFUNC, CurlShareLock);
+        curl_share_setopt(curlShare, CURLSHOPT_UNLOCKFUNC, CurlShareUnlock);
+        curl_share_setopt(curlShare, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+        staticHeaders = curl_slist_append(staticHeaders, "Accept: application/json");
+        staticHeaders = curl_slist_append(staticHeaders, "Content-Type: application/json; charset=utf-8");
+        staticHeaders = curl_slist_append(staticHeaders, ("X-PlayFabSDK: " + PlayFabSettings::versionString).c_str());
+        staticHeaders = curl_slist_append(staticHeaders, "X-ReportErrorAsSuccess: true");
+
         threadRunning = true;
-        pfHttpWorkerThread = std::thread(&PlayFabHttp::WorkerThread, this);
+        workerCount = (std::max)(workerCount, static_cast<size_t>(1));
+        for (size_t i = 0; i < workerCount; ++i)
+            pfHttpWorkerThreads.emplace_back(&PlayFabHttp::WorkerThread, this);
     };
 
     PlayFabHttp::~PlayFabHttp()
     {
         threadRunning = false;
-        pfHttpWorkerThread.join();
+        for (auto& workerThread : pfHttpWorkerThreads)
+            workerThread.join();
+
+        { // LOCK callbackMutex
+            std::unique_lock<std::mutex> lock(callbackMutex);
+            callbackThreadsRunning = false;
+        } // UNLOCK callbackMutex
+        callbackCondition.notify_all();
+        for (auto& callbackThread : callbackWorkerThreads)
+            callbackThread.join();
+        for (size_t i = 0; i < pendingCallbacks.size(); ++i)
+            delete pendingCallbacks[i];
+        pendingCallbacks.clear();
+
         for (size_t i = 0; i < pendingRequests.size(); ++i)
             delete pendingRequests[i];
         pendingRequests.clear();
         for (size_t i = 0; i < pendingResults.size(); ++i)
             delete pendingResults[i];
         pendingResults.clear();
+        curl_slist_free_all(staticHeaders);
+        curl_share_cleanup(curlShare);
+        curl_global_cleanup();
+
+#ifdef GSDK_LINUX
+        if (resultEventFd != -1)
+            close(resultEventFd);
+#endif
     }
 
     void PlayFabHttp::MakeInstance()
     {
-        class _PlayFabHttp : public PlayFabHttp {}; // Hack to bypass private constructor on PlayFabHttp
-
-        if (httpInstance == nullptr)
+        // The warm-up, token refresh and write-behind threads can all get here at once, so only one of them may create it
+        std::call_once(httpInstanceCreated, []()
         {
-            httpInstance = std::make_unique<_PlayFabHttp>();
-        }
+            httpInstance = std::make_unique<PlayFabHttp>(PlayFabContext::Default(), PlayFabSettings::maxConcurrentRequests);
+        });
     }
 
     void PlayFabHttp::WorkerThread()
     {
         size_t queueSize;
+        // Only this thread uses it, so its connection is kept open between requests without sharing a connection cache
+        CURL* curlHandle = curl_easy_init();
+        unsigned int lastWarmRound = 0;
 
         while (this->threadRunning)
         {
             CallRequestContainer* reqContainer = nullptr;
+            unsigned int warmRoundJoined = 0;
 
             { // LOCK httpRequestMutex
                 std::unique_lock<std::mutex> lock(this->httpRequestMutex);
 
+                // A warm-up is quick, and only asked for while the keep-alive is running, so it goes ahead of requests
+                if (warmSlotsLeft != 0 && lastWarmRound != warmRound)
+                {
+                    --warmSlotsLeft;
+                    lastWarmRound = warmRoundJoined = warmRound;
+                }
+
                 queueSize = this->pendingRequests.size();
-                if (queueSize != 0)
+                if (warmRoundJoined == 0 && queueSize != 0)
                 {
                     reqContainer = this->pendingRequests[this->pendingRequests.size() - 1];
                     this->pendingRequests.pop_back();
                 }
             } // UNLOCK httpRequestMutex
 
+            if (warmRoundJoined != 0)
+            {
+                const bool warmed = WarmConnection(curlHandle);
+                { // LOCK httpRequestMutex
+                    std::unique_lock<std::mutex> lock(this->httpRequestMutex);
+                    // A round that WarmConnections gave up on has nobody left to count it
+                    if (warmRoundJoined == warmRound)
+                    {
+                        ++warmFinished;
+                        if (warmed)
+                            ++warmSucceeded;
+                    }
+                } // UNLOCK httpRequestMutex
+                warmCondition.notify_all();
+                continue;
+            }
+
             if (queueSize == 0)
             {
                 std::this_thread::sleep_for(std::chrono::milliseconds(10));
@@ -90,69 +200,137 @@ namespace PlayFab
             }
 
             if (reqContainer != nullptr)
-                ExecuteRequest(*reqContainer);
+                ExecuteRequest(*reqContainer, curlHandle);
+        }
+
+        curl_easy_cleanup(curlHandle);
+    }
+
+    void PlayFabHttp::CallbackThread()
+    {
+        std::unique_lock<std::mutex> lock(callbackMutex);
+
+        while (callbackThreadsRunning)
+        {
+            if (pendingCallbacks.empty())
+            {
+                callbackCondition.wait(lock);
+                continue;
+            }
+
+            CallRequestContainer* reqContainer = pendingCallbacks.front();
+            pendingCallbacks.pop_front();
+
+            lock.unlock();
+            HandleResults(*reqContainer);
+            delete reqContainer;
+            lock.lock();
         }
     }
 
     void PlayFabHttp::HandleCallback(CallRequestContainer& reqContainer)
     {
         reqContainer.finished = true;
-        if (PlayFabSettings::threadedCallbacks)
-            HandleResults(reqContainer);
 
-        PlayFabHttp& instance = reinterpret_cast<PlayFabHttp&>(Get());
         if (!PlayFabSettings::threadedCallbacks)
         {
             { // LOCK httpRequestMutex
-                std::unique_lock<std::mutex> lock(instance.httpRequestMutex);
-                instance.pendingResults.push_back(&reqContainer);
+                std::unique_lock<std::mutex> lock(httpRequestMutex);
+                if (pendingResults.empty())
+                    SetResultsSignaled(true);
+                pendingResults.push_back(&reqContainer);
             } // UNLOCK httpRequestMutex
+            return;
+        }
+
+        CallRequestContainer* container = &reqContainer;
+        if (PlayFabSettings::callbackExecutor != nullptr)
+        {
+            PlayFabSettings::callbackExecutor([this, container]()
+            {
+                HandleResults(*container);
+                delete container;
+            });
+            return;
         }
+
+        { // LOCK callbackMutex
+            std::unique_lock<std::mutex> lock(callbackMutex);
+            if (callbackWorkerThreads.empty())
+            {
+                callbackThreadsRunning = true;
+                const size_t callbackThreadCount = (std::max)(PlayFabSettings::callbackThreads, static_cast<size_t>(1));
+                for (size_t i = 0; i < callbackThreadCount; ++i)
+                    callbackWorkerThreads.emplace_back(&PlayFabHttp::CallbackThread, this);
+            }
+            pendingCallbacks.push_back(container);
+        } // UNLOCK callbackMutex
+        callbackCondition.notify_one();
     }
 
     size_t PlayFabHttp::CurlReceiveData(char* buffer, size_t blockSize, size_t blockCount, void* userData)
     {
+        // Responses can arrive in several blocks, so they are only parsed once the transfer is complete
         CallRequestContainer* reqContainer = reinterpret_cast<CallRequestContainer*>(userData);
-        reqContainer->responseString.assign(buffer, blockSize * blockCount);
+        reqContainer->responseString.append(buffer, blockSize * blockCount);
+        return (blockSize * blockCount);
+    }
 
+    void PlayFabHttp::ParseResponse(CallRequestContainer& reqContainer)
+    {
         Json::CharReaderBuilder jsonReaderFactory;
-        Json::CharReader* jsonReader(jsonReaderFactory.newCharReader());
+        std::unique_ptr<Json::CharReader> jsonReader(jsonReaderFactory.newCharReader());
         JSONCPP_STRING jsonParseErrors;
-        const bool parsedSuccessfully = jsonReader->parse(reqContainer->responseString.c_str(), reqContainer->responseString.c_str() + reqContainer->responseString.length(), &reqContainer->responseJson, &jsonParseErrors);
+        const bool parsedSuccessfully = jsonReader->parse(reqContainer.responseString.c_str(), reqContainer.responseString.c_str() + reqContainer.responseString.length(), &reqContainer.responseJson, &jsonParseErrors);
 
         if (parsedSuccessfully)
         {
-            reqContainer->errorWrapper.HttpCode = reqContainer->responseJson.get("code", Json::Value::null).asInt();
-            reqContainer->errorWrapper.HttpStatus = reqContainer->responseJson.get("status", Json::Value::null).asString();
-            reqContainer->errorWrapper.Data = reqContainer->responseJson.get("data", Json::Value::null);
-            reqContainer->errorWrapper.ErrorName = reqContainer->responseJson.get("error", Json::Value::null).asString();
-            reqContainer->errorWrapper.ErrorMessage = reqContainer->responseJson.get("errorMessage", Json::Value::null).asString();
-            reqContainer->errorWrapper.ErrorDetails = reqContainer->responseJson.get("errorDetails", Json::Value::null);
+            reqContainer.errorWrapper.HttpCode = reqContainer.responseJson.get("code", Json::Value::null).asInt();
+            reqContainer.errorWrapper.HttpStatus = reqContainer.responseJson.get("status", Json::Value::null).asString();
+            reqContainer.errorWrapper.ErrorName = reqContainer.responseJson.get("error", Json::Value::null).asString();
+            reqContainer.errorWrapper.ErrorMessage = reqContainer.responseJson.get("errorMessage", Json::Value::null).asString();
+            // The response json is not used after this, so take the subtrees instead of copying them
+            if (reqContainer.responseJson.isMember("data"))
+                reqContainer.errorWrapper.Data.swap(reqContainer.responseJson["data"]);
+            if (reqContainer.responseJson.isMember("errorDetails"))
+                reqContainer.errorWrapper.ErrorDetails.swap(reqContainer.responseJson["errorDetails"]);
         }
         else
         {
-            reqContainer->errorWrapper.HttpCode = 408;
-            reqContainer->errorWrapper.HttpStatus = reqContainer->responseString;
-            reqContainer->errorWrapper.ErrorCode = PlayFabErrorConnectionTimeout;
-            reqContainer->errorWrapper.ErrorName = "Failed to parse PlayFab response";
-            reqContainer->errorWrapper.ErrorMessage = jsonParseErrors;
+            reqContainer.errorWrapper.HttpCode = 408;
+            reqContainer.errorWrapper.HttpStatus = reqContainer.responseString;
+            reqContainer.errorWrapper.ErrorCode = PlayFabErrorConnectionTimeout;
+            reqContainer.errorWrapper.ErrorName = "Failed to parse PlayFab response";
+            reqContainer.errorWrapper.ErrorMessage = jsonParseErrors;
         }
-
-        HandleCallback(*reqContainer);
-        return (blockSize * blockCount);
     }
 
-    void PlayFabHttp::AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData)
+    void PlayFabHttp::AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, Json::Value requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData)
     {
         CallRequestContainer* reqContainer = new CallRequestContainer();
         reqContainer->errorWrapper.UrlPath = urlPath;
         reqContainer->authKey = authKey;
         reqContainer->authValue = authValue;
-        reqContainer->errorWrapper.Request = requestBody;
+        reqContainer->errorWrapper.Request = std::make_shared<const Json::Value>(std::move(requestBody));
         reqContainer->internalCallback = internalCallback;
         reqContainer->successCallback = successCallback;
         reqContainer->errorCallback = errorCallback;
         reqContainer->customData = customData;
+        reqContainer->context = &context;
+
+        // Joins the trace current on the calling thread, or starts one of its own when spans are exported anyway
+        const auto& parentContext = Microsoft::Azure::Gaming::GSDKTrace::getCurrentContext();
+        if (parentContext.isValid())
+        {
+            reqContainer->traceContext = parentContext.newChild();
+            reqContainer->parentSpanId = parentContext.m_spanId;
+        }
+        else if (Microsoft::Azure::Gaming::GSDKTrace::isExporting())
+        {
+            reqContainer->traceContext = Microsoft::Azure::Gaming::TraceContext::newTrace();
+        }
+        reqContainer->queuedTime = std::chrono::system_clock::now();
+        reqContainer->queuedClock = std::chrono::steady_clock::now();
 
         { // LOCK httpRequestMutex
             std::unique_lock<std::mutex> lock(httpRequestMutex);
@@ -160,25 +338,36 @@ namespace PlayFab
         } // UNLOCK httpRequestMutex
     }
 
-    void PlayFabHttp::ExecuteRequest(CallRequestContainer& reqContainer)
+    void PlayFabHttp::ExecuteRequest(CallRequestContainer& reqContainer, CURL* curlHandle)
     {
-        // Set up curl handle
-        reqContainer.curlHandle = curl_easy_init();
-        curl_easy_reset(reqContainer.curlHandle);
-        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_URL, PlayFabSettings::GetUrl(reqContainer.errorWrapper.UrlPath).c_str());
+        const RequestTemplate& requestTemplate = GetRequestTemplate(reqContainer.errorWrapper.UrlPath);
 
-        // Set up headers
-        reqContainer.curlHttpHeaders = nullptr;
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, "Accept: application/json");
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, "Content-Type: application/json; charset=utf-8");
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, ("X-PlayFabSDK: " + PlayFabSettings::versionString).c_str());
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, "X-ReportErrorAsSuccess: true");
+        // Set up curl handle, where resetting it drops the last request's options but keeps its connection
+        curl_easy_reset(curlHandle);
+        reqContainer.curlHandle = curlHandle;
+        SetConnectionOptions(reqContainer.curlHandle);
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_URL, requestTemplate.url.c_str());
+
+        // Set up headers, where only the auth and traceparent headers are built per request
         if (reqContainer.authKey.length() != 0 && reqContainer.authValue.length() != 0)
             reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, (reqContainer.authKey + ": " + reqContainer.authValue).c_str());
-        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_HTTPHEADER, reqContainer.curlHttpHeaders);
+        if (reqContainer.traceContext.isValid())
+            reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, ("traceparent: " + reqContainer.traceContext.toTraceparent()).c_str());
+        curl_slist* headers = requestTemplate.staticHeaders;
+        if (reqContainer.curlHttpHeaders != nullptr)
+        {
+            reqContainer.curlHttpHeadersTail = reqContainer.curlHttpHeaders;
+            while (reqContainer.curlHttpHeadersTail->next != nullptr)
+                reqContainer.curlHttpHeadersTail = reqContainer.curlHttpHeadersTail->next;
+            reqContainer.curlHttpHeadersTail->next = headers;
+            headers = reqContainer.curlHttpHeaders;
+        }
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_HTTPHEADER, headers);
 
         // Set up post & payload
-        std::string payload = reqContainer.errorWrapper.Request.toStyledString();
+        std::string payload = reqContainer.errorWrapper.Request->toStyledString();
+        if (!PlayFabSettings::keepRequestJson)
+            reqContainer.errorWrapper.Request.reset();
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_POST, nullptr);
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_POSTFIELDS, payload.c_str());
 
@@ -189,9 +378,16 @@ namespace PlayFab
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_WRITEFUNCTION, CurlReceiveData);
 
         // Send
-        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_SSL_VERIFYPEER, false); // TODO: Replace this with a ca-bundle ref???
+        reqContainer.sentClock = std::chrono::steady_clock::now();
         const auto res = curl_easy_perform(reqContainer.curlHandle);
-        if (res != CURLE_OK)
+        reqContainer.receivedClock = std::chrono::steady_clock::now();
+        reqContainer.curlHandle = nullptr; // The worker reuses it for its next request while this one's callbacks may still be running
+        if (res == CURLE_OK)
+        {
+            ParseResponse(reqContainer);
+            HandleCallback(reqContainer);
+        }
+        else
         {
             reqContainer.errorWrapper.HttpCode = 408;
             reqContainer.errorWrapper.HttpStatus = "Failed to contact server";
@@ -202,20 +398,77 @@ namespace PlayFab
         }
     }
 
+    const PlayFabHttp::RequestTemplate& PlayFabHttp::GetRequestTemplate(const std::string& urlPath)
+    {
+        std::unique_lock<std::mutex> lock(requestTemplateMutex);
+        auto& requestTemplate = requestTemplates[urlPath];
+        if (requestTemplate == nullptr)
+            requestTemplate.reset(new RequestTemplate{ context.GetUrl(urlPath), staticHeaders });
+        // Templates are never replaced or removed, so the reference stays valid after unlocking
+        return *requestTemplate;
+    }
+
     void PlayFabHttp::HandleResults(CallRequestContainer& reqContainer)
     {
-        // The success case must be handled by a function which is aware of the ResultType
-        if (reqContainer.errorWrapper.HttpCode == 200)
-        {
-            reqContainer.internalCallback(reqContainer); // Unpacks the result as ResultType and invokes successCallback according to that type
-        }
-        else // Process the error case
-        {
-            if (PlayFabSettings::globalErrorHandler != nullptr)
-                PlayFabSettings::globalErrorHandler(reqContainer.errorWrapper, reqContainer.customData);
-            if (reqContainer.errorCallback != nullptr)
-                reqContainer.errorCallback(reqContainer.errorWrapper, reqContainer.customData);
+        const auto callbackStart = std::chrono::steady_clock::now();
+
+        { // The callbacks run in the request's span, so the calls they make are its children
+            Microsoft::Azure::Gaming::ScopedTraceContext scopedTraceContext(reqContainer.traceContext);
+
+            // The success case must be handled by a function which is aware of the ResultType
+            if (reqContainer.errorWrapper.HttpCode == 200)
+            {
+                reqContainer.internalCallback(reqContainer); // Unpacks the result as ResultType and invokes successCallback according to that type
+            }
+            else // Process the error case
+            {
+                if (PlayFabSettings::globalErrorHandler != nullptr)
+                    PlayFabSettings::globalErrorHandler(reqContainer.errorWrapper, reqContainer.customData);
+                if (reqContainer.errorCallback != nullptr)
+                    reqContainer.errorCallback(reqContainer.errorWrapper, reqContainer.customData);
+            }
         }
+
+        const auto callbackEnd = std::chrono::steady_clock::now();
+        const auto callbackDuration = std::chrono::duration_cast<std::chrono::microseconds>(callbackEnd - callbackStart);
+        { // LOCK metricsMutex
+            std::unique_lock<std::mutex> lock(metricsMutex);
+            PlayFabCallbackMetrics& metrics = callbackMetrics[reqContainer.errorWrapper.UrlPath];
+            ++metrics.callbackCount;
+            metrics.totalDuration += callbackDuration;
+            metrics.maxDuration = (std::max)(metrics.maxDuration, callbackDuration);
+        } // UNLOCK metricsMutex
+
+        if (reqContainer.traceContext.isValid() && Microsoft::Azure::Gaming::GSDKTrace::isExporting())
+            ExportSpan(reqContainer, callbackStart, callbackEnd);
+    }
+
+    void PlayFabHttp::ExportSpan(const CallRequestContainer& reqContainer, std::chrono::steady_clock::time_point callbackStart, std::chrono::steady_clock::time_point callbackEnd)
+    {
+        typedef std::chrono::duration<double, std::milli> Milliseconds;
+
+        Microsoft::Azure::Gaming::TraceSpan span;
+        span.m_name = reqContainer.errorWrapper.UrlPath;
+        span.m_kind = Microsoft::Azure::Gaming::TraceSpanKind::Client;
+        span.m_context = reqContainer.traceContext;
+        span.m_parentSpanId = reqContainer.parentSpanId;
+        // The wall clock only anchors the span, its length comes from the steady clock like its parts
+        span.m_startTime = reqContainer.queuedTime;
+        span.m_endTime = reqContainer.queuedTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(callbackEnd - reqContainer.queuedClock);
+        span.m_isError = reqContainer.errorWrapper.HttpCode != 200;
+        span.m_stringAttributes["url.path"] = reqContainer.errorWrapper.UrlPath;
+        span.m_numberAttributes["http.response.status_code"] = reqContainer.errorWrapper.HttpCode;
+        span.m_numberAttributes["playfab.queue_ms"] = Milliseconds(reqContainer.sentClock - reqContainer.queuedClock).count(); // Waiting for a worker thread
+        span.m_numberAttributes["playfab.network_ms"] = Milliseconds(reqContainer.receivedClock - reqContainer.sentClock).count();
+        span.m_numberAttributes["playfab.result_wait_ms"] = Milliseconds(callbackStart - reqContainer.receivedClock).count(); // Waiting for Update or a callback thread
+        span.m_numberAttributes["playfab.callback_ms"] = Milliseconds(callbackEnd - callbackStart).count();
+        Microsoft::Azure::Gaming::GSDKTrace::exportSpan(span);
+    }
+
+    std::map<std::string, PlayFabCallbackMetrics> PlayFabHttp::GetCallbackMetrics()
+    {
+        std::unique_lock<std::mutex> lock(metricsMutex);
+        return callbackMetrics;
     }
 
     size_t PlayFabHttp::Update()
@@ -234,10 +487,106 @@ namespace PlayFab
 
             reqContainer = pendingResults[pendingResults.size() - 1];
             pendingResults.pop_back();
+            if (pendingResults.empty())
+                SetResultsSignaled(false);
         } // UNLOCK httpRequestMutex
 
         HandleResults(*reqContainer);
         delete reqContainer;
         return resultCount;
     }
+
+    size_t PlayFabHttp::UpdateBatch(size_t maxResults)
+    {
+        std::vector<CallRequestContainer*> results;
+
+        { // LOCK httpRequestMutex
+            std::unique_lock<std::mutex> lock(httpRequestMutex);
+            // Taken from the back, in the same order as Update
+            const size_t resultCount = (std::min)(maxResults, pendingResults.size());
+            results.assign(pendingResults.rbegin(), pendingResults.rbegin() + resultCount);
+            pendingResults.resize(pendingResults.size() - resultCount);
+            if (resultCount != 0 && pendingResults.empty())
+                SetResultsSignaled(false);
+        } // UNLOCK httpRequestMutex
+
+        for (CallRequestContainer* reqContainer : results)
+        {
+            HandleResults(*reqContainer);
+            delete reqContainer;
+        }
+        return results.size();
+    }
+
+    int PlayFabHttp::GetResultEventFd()
+    {
+        return resultEventFd;
+    }
+
+    void PlayFabHttp::SetResultsSignaled(bool signaled)
+    {
+#ifdef GSDK_LINUX
+        if (resultEventFd == -1)
+            return;
+
+        // The counter only ever holds 0 or 1, so one read always clears it
+        uint64_t counter = 1;
+        if (signaled)
+            (void)write(resultEventFd, &counter, sizeof(counter));
+        else
+            (void)read(resultEventFd, &counter, sizeof(counter));
+#else
+        (void)signaled;
+#endif
+    }
+
+    size_t PlayFabHttp::WarmConnections(size_t connectionCount)
+    {
+        // Each worker only ever uses the connection in its own handle, so there is nothing to gain from warming more connections than there are workers.
+        // Workers sending a request join the round once it is done, and ones that take longer than a warm-up could are not waited for.
+        std::unique_lock<std::mutex> warmLock(warmMutex);
+        std::unique_lock<std::mutex> lock(httpRequestMutex);
+        if (++warmRound == 0)
+            ++warmRound; // 0 means "no round" to the workers
+        const size_t warmSlots = (std::min)(connectionCount, pfHttpWorkerThreads.size());
+        warmSlotsLeft = warmSlots;
+        warmFinished = 0;
+        warmSucceeded = 0;
+
+        warmCondition.wait_for(lock, std::chrono::seconds(15), [this, warmSlots]() { return warmFinished == warmSlots; });
+        warmSlotsLeft = 0;
+        return warmSucceeded;
+    }
+
+    bool PlayFabHttp::WarmConnection(CURL* curlHandle)
+    {
+        // Any response at all means the connection is up, whatever the status code
+        curl_easy_reset(curlHandle);
+        SetConnectionOptions(curlHandle);
+        curl_easy_setopt(curlHandle, CURLOPT_URL, GetRequestTemplate("/").url.c_str());
+        curl_easy_setopt(curlHandle, CURLOPT_NOBODY, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_TIMEOUT_MS, 10000L);
+        return curl_easy_perform(curlHandle) == CURLE_OK;
+    }
+
+    void PlayFabHttp::SetConnectionOptions(CURL* curlHandle)
+    {
+        // A connection is only reused by requests with matching connection options, so every request gets the same ones
+        curl_easy_setopt(curlHandle, CURLOPT_SHARE, curlShare);
+        curl_easy_setopt(curlHandle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_TCP_KEEPIDLE, 30L);
+        curl_easy_setopt(curlHandle, CURLOPT_TCP_KEEPINTVL, 15L);
+        curl_easy_setopt(curlHandle, CURLOPT_SSL_VERIFYPEER, false); // TODO: Replace this with a ca-bundle ref???
+    }
+
+    void PlayFabHttp::CurlShareLock(CURL*, curl_lock_data data, curl_lock_access, void* userData)
+    {
+        reinterpret_cast<PlayFabHttp*>(userData)->curlShareMutexes[data].lock();
+    }
+
+    void PlayFabHttp::CurlShareUnlock(CURL*, curl_lock_data data, void* userData)
+    {
+        reinterpret_cast<PlayFabHttp*>(userData)->curlShareMutexes[data].unlock();
+    }
 }
@@ -28,28 +28,36 @@ namespace PlayFab
         ErrorCallback errorCallback,
         void* customData
     )
+    {
+        AuthUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
+    }
+
+    void PlayFabMatchmakerAPI::AuthUser(
+        PlayFabContext& context,
+        AuthUserRequest& request,
+        ProcessApiCallback<AuthUserResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/AuthUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAuthUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthUserResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Matchmaker/AuthUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AuthUserResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthUserResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabMatchmakerAPI::OnAuthUserResult(CallRequestContainer& request)
+    void PlayFabMatchmakerAPI::PlayerJoined(
+        PlayerJoinedRequest& request,
+        ProcessApiCallback<PlayerJoinedResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AuthUserResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AuthUserResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        PlayerJoined(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::PlayerJoined(
+        PlayFabContext& context,
         PlayerJoinedRequest& request,
         ProcessApiCallback<PlayerJoinedResponse> callback,
         ErrorCallback errorCallback,
@@ -57,26 +65,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/PlayerJoined", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnPlayerJoinedResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerJoinedResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Matchmaker/PlayerJoined", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<PlayerJoinedResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerJoinedResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabMatchmakerAPI::OnPlayerJoinedResult(CallRequestContainer& request)
+    void PlayFabMatchmakerAPI::PlayerLeft(
+        PlayerLeftRequest& request,
+        ProcessApiCallback<PlayerLeftResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        PlayerJoinedResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<PlayerJoinedResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        PlayerLeft(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::PlayerLeft(
+        PlayFabContext& context,
         PlayerLeftRequest& request,
         ProcessApiCallback<PlayerLeftResponse> callback,
         ErrorCallback errorCallback,
@@ -84,26 +89,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/PlayerLeft", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnPlayerLeftResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerLeftResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Matchmaker/PlayerLeft", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<PlayerLeftResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerLeftResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabMatchmakerAPI::OnPlayerLeftResult(CallRequestContainer& request)
+    void PlayFabMatchmakerAPI::StartGame(
+        StartGameRequest& request,
+        ProcessApiCallback<StartGameResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        PlayerLeftResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<PlayerLeftResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        StartGame(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::StartGame(
+        PlayFabContext& context,
         StartGameRequest& request,
         ProcessApiCallback<StartGameResponse> callback,
         ErrorCallback errorCallback,
@@ -111,26 +113,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/StartGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnStartGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Matchmaker/StartGame", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<StartGameResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabMatchmakerAPI::OnStartGameResult(CallRequestContainer& request)
+    void PlayFabMatchmakerAPI::UserInfo(
+        UserInfoRequest& request,
+        ProcessApiCallback<UserInfoResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        StartGameResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<StartGameResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UserInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::UserInfo(
+        PlayFabContext& context,
         UserInfoRequest& request,
         ProcessApiCallback<UserInfoResponse> callback,
         ErrorCallback errorCallback,
@@ -138,24 +137,11 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/UserInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUserInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UserInfoResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Matchmaker/UserInfo", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UserInfoResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UserInfoResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabMatchmakerAPI::OnUserInfoResult(CallRequestContainer& request)
-    {
-        UserInfoResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UserInfoResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
-    }
 }
 
 #endif
@@ -0,0 +1,166 @@
+#include <gsdkCommonPch.h>
+
+#ifdef ENABLE_PLAYFABSERVER_API
+
+#include <gsdk.h>
+#include <playfab/PlayFabPlayerPrefetch.h>
+
+namespace PlayFab
+{
+    using namespace ServerModels;
+
+    std::mutex PlayFabPlayerPrefetch::cacheMutex;
+    std::unordered_map<std::string, PlayFabPlayerPrefetch::CacheEntry> PlayFabPlayerPrefetch::cache;
+    std::deque<std::string> PlayFabPlayerPrefetch::queuedFetches;
+    size_t PlayFabPlayerPrefetch::fetchesInFlight = 0;
+    size_t PlayFabPlayerPrefetch::maxFetchesInFlight = 4;
+    size_t PlayFabPlayerPrefetch::sessionGeneration = 0;
+    GetPlayerCombinedInfoRequestParams PlayFabPlayerPrefetch::requestParameters;
+    Microsoft::Azure::Gaming::GSDKSubscriptionId PlayFabPlayerPrefetch::allocationSubscription = 0;
+
+    void PlayFabPlayerPrefetch::Enable(const GetPlayerCombinedInfoRequestParams& infoRequestParameters, size_t maxParallelFetches)
+    {
+        using namespace Microsoft::Azure::Gaming;
+
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        requestParameters = infoRequestParameters;
+        maxFetchesInFlight = (std::max)(maxParallelFetches, static_cast<size_t>(1));
+
+        // Inline, so the fetches are queued before readyForPlayers returns. Prefetch only queues requests, so it doesn't hold up the heartbeat.
+        if (allocationSubscription == 0)
+        {
+            allocationSubscription = GSDK::subscribe(GSDKEventType::Allocation, [](const GSDKEvent& allocation)
+            {
+                Prefetch(allocation.m_initialPlayers);
+            }, GSDKEventExecutor::Inline);
+        }
+    }
+
+    void PlayFabPlayerPrefetch::Disable()
+    {
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        if (allocationSubscription != 0)
+        {
+            Microsoft::Azure::Gaming::GSDK::unsubscribe(allocationSubscription);
+            allocationSubscription = 0;
+        }
+    }
+
+    void PlayFabPlayerPrefetch::Prefetch(const std::vector<std::string>& playFabIds)
+    {
+        std::vector<std::string> toIssue;
+        size_t generation;
+
+        { // LOCK cacheMutex
+            std::unique_lock<std::mutex> lock(cacheMutex);
+            generation = ++sessionGeneration;
+            cache.clear();
+            queuedFetches.clear();
+            fetchesInFlight = 0;
+
+            for (const auto& playFabId : playFabIds)
+            {
+                // Duplicate ids only need to be fetched once
+                if (cache.emplace(playFabId, CacheEntry()).second)
+                    queuedFetches.push_back(playFabId);
+            }
+
+            TakeQueuedFetches(toIssue);
+        } // UNLOCK cacheMutex
+
+        IssueFetches(toIssue, generation);
+    }
+
+    PlayFabPlayerPrefetch::Status PlayFabPlayerPrefetch::GetPlayerInfo(const std::string& playFabId, GetPlayerCombinedInfoResultPayload& outPayload, PlayFabError* outError)
+    {
+        std::unique_lock<std::mutex> lock(cacheMutex);
+
+        const auto entry = cache.find(playFabId);
+        if (entry == cache.end())
+            return Status::NotRequested;
+
+        if (entry->second.status == Status::Ready)
+            outPayload = entry->second.payload;
+        else if (entry->second.status == Status::Failed && outError != nullptr)
+            *outError = entry->second.error;
+        return entry->second.status;
+    }
+
+    bool PlayFabPlayerPrefetch::IsComplete()
+    {
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        return queuedFetches.empty() && fetchesInFlight == 0;
+    }
+
+    void PlayFabPlayerPrefetch::Clear()
+    {
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        ++sessionGeneration;
+        cache.clear();
+        queuedFetches.clear();
+        fetchesInFlight = 0;
+    }
+
+    // Requires cacheMutex to be held
+    void PlayFabPlayerPrefetch::TakeQueuedFetches(std::vector<std::string>& outPlayFabIds)
+    {
+        while (fetchesInFlight < maxFetchesInFlight && !queuedFetches.empty())
+        {
+            outPlayFabIds.push_back(std::move(queuedFetches.front()));
+            queuedFetches.pop_front();
+            ++fetchesInFlight;
+        }
+    }
+
+    void PlayFabPlayerPrefetch::IssueFetches(const std::vector<std::string>& playFabIds, size_t generation)
+    {
+        if (playFabIds.empty())
+            return;
+
+        GetPlayerCombinedInfoRequest request;
+        { // LOCK cacheMutex
+            std::unique_lock<std::mutex> lock(cacheMutex);
+            request.InfoRequestParameters = requestParameters;
+        } // UNLOCK cacheMutex
+
+        for (const auto& playFabId : playFabIds)
+        {
+            request.PlayFabId = playFabId;
+            PlayFabServerAPI::GetPlayerCombinedInfo(request,
+                [generation, playFabId](const GetPlayerCombinedInfoResult& result, void*) { OnFetchComplete(generation, playFabId, &result, nullptr); },
+                [generation, playFabId](const PlayFabError& error, void*) { OnFetchComplete(generation, playFabId, nullptr, &error); });
+        }
+    }
+
+    void PlayFabPlayerPrefetch::OnFetchComplete(size_t generation, const std::string& playFabId, const GetPlayerCombinedInfoResult* result, const PlayFabError* error)
+    {
+        std::vector<std::string> toIssue;
+
+        { // LOCK cacheMutex
+            std::unique_lock<std::mutex> lock(cacheMutex);
+            if (generation != sessionGeneration)
+                return; // This result belongs to a session that has since been replaced or cleared
+
+            CacheEntry& entry = cache[playFabId];
+            if (result != nullptr)
+            {
+                // The payload is legitimately empty when nothing was requested
+                if (result->InfoResultPayload.notNull())
+                    entry.payload = result->InfoResultPayload.mValue;
+                entry.status = Status::Ready;
+            }
+            else
+            {
+                entry.error = *error;
+                entry.status = Status::Failed;
+            }
+
+            --fetchesInFlight;
+            TakeQueuedFetches(toIssue);
+        } // UNLOCK cacheMutex
+
+        IssueFetches(toIssue, generation);
+    }
+}
+
+#endif
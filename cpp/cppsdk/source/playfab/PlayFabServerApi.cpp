@@ -29,24 +29,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddCharacterVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddCharacterVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
+        AddCharacterVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnAddCharacterVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabServerAPI::AddCharacterVirtualCurrency(
+        PlayFabContext& context,
+        AddCharacterVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyCharacterVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyCharacterVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyCharacterVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/AddCharacterVirtualCurrency", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyCharacterVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::AddFriend(
@@ -56,24 +53,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddFriend", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        AddFriend(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnAddFriendResult(CallRequestContainer& request)
+    void PlayFabServerAPI::AddFriend(
+        PlayFabContext& context,
+        AddFriendRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/AddFriend", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::AddPlayerTag(
@@ -83,24 +77,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddPlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddPlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
+        AddPlayerTag(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnAddPlayerTagResult(CallRequestContainer& request)
+    void PlayFabServerAPI::AddPlayerTag(
+        PlayFabContext& context,
+        AddPlayerTagRequest& request,
+        ProcessApiCallback<AddPlayerTagResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddPlayerTagResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddPlayerTagResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/AddPlayerTag", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AddPlayerTagResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::AddSharedGroupMembers(
@@ -110,24 +101,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddSharedGroupMembers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
+        AddSharedGroupMembers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnAddSharedGroupMembersResult(CallRequestContainer& request)
+    void PlayFabServerAPI::AddSharedGroupMembers(
+        PlayFabContext& context,
+        AddSharedGroupMembersRequest& request,
+        ProcessApiCallback<AddSharedGroupMembersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AddSharedGroupMembersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AddSharedGroupMembersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/AddSharedGroupMembers", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AddSharedGroupMembersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::AddUserVirtualCurrency(
@@ -137,24 +125,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        AddUserVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnAddUserVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabServerAPI::AddUserVirtualCurrency(
+        PlayFabContext& context,
+        AddUserVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyUserVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/AddUserVirtualCurrency", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyUserVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::AuthenticateSessionTicket(
@@ -164,24 +149,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AuthenticateSessionTicket", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAuthenticateSessionTicketResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthenticateSessionTicketResult>(callback)), errorCallback, customData);
+        AuthenticateSessionTicket(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnAuthenticateSessionTicketResult(CallRequestContainer& request)
+    void PlayFabServerAPI::AuthenticateSessionTicket(
+        PlayFabContext& context,
+        AuthenticateSessionTicketRequest& request,
+        ProcessApiCallback<AuthenticateSessionTicketResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AuthenticateSessionTicketResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AuthenticateSessionTicketResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/AuthenticateSessionTicket", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AuthenticateSessionTicketResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthenticateSessionTicketResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::AwardSteamAchievement(
@@ -191,24 +173,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AwardSteamAchievement", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAwardSteamAchievementResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AwardSteamAchievementResult>(callback)), errorCallback, customData);
+        AwardSteamAchievement(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnAwardSteamAchievementResult(CallRequestContainer& request)
+    void PlayFabServerAPI::AwardSteamAchievement(
+        PlayFabContext& context,
+        AwardSteamAchievementRequest& request,
+        ProcessApiCallback<AwardSteamAchievementResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        AwardSteamAchievementResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<AwardSteamAchievementResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/AwardSteamAchievement", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<AwardSteamAchievementResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AwardSteamAchievementResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::BanUsers(
@@ -218,24 +197,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/BanUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnBanUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
+        BanUsers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnBanUsersResult(CallRequestContainer& request)
+    void PlayFabServerAPI::BanUsers(
+        PlayFabContext& context,
+        BanUsersRequest& request,
+        ProcessApiCallback<BanUsersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        BanUsersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<BanUsersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/BanUsers", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<BanUsersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::ConsumeItem(
@@ -245,24 +221,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ConsumeItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnConsumeItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
+        ConsumeItem(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnConsumeItemResult(CallRequestContainer& request)
+    void PlayFabServerAPI::ConsumeItem(
+        PlayFabContext& context,
+        ConsumeItemRequest& request,
+        ProcessApiCallback<ConsumeItemResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ConsumeItemResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ConsumeItemResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/ConsumeItem", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ConsumeItemResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::CreateSharedGroup(
@@ -272,24 +245,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/CreateSharedGroup", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
+        CreateSharedGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnCreateSharedGroupResult(CallRequestContainer& request)
+    void PlayFabServerAPI::CreateSharedGroup(
+        PlayFabContext& context,
+        CreateSharedGroupRequest& request,
+        ProcessApiCallback<CreateSharedGroupResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CreateSharedGroupResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<CreateSharedGroupResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/CreateSharedGroup", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<CreateSharedGroupResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::DeleteCharacterFromUser(
@@ -299,24 +269,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeleteCharacterFromUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteCharacterFromUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteCharacterFromUserResult>(callback)), errorCallback, customData);
+        DeleteCharacterFromUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnDeleteCharacterFromUserResult(CallRequestContainer& request)
+    void PlayFabServerAPI::DeleteCharacterFromUser(
+        PlayFabContext& context,
+        DeleteCharacterFromUserRequest& request,
+        ProcessApiCallback<DeleteCharacterFromUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeleteCharacterFromUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeleteCharacterFromUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/DeleteCharacterFromUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<DeleteCharacterFromUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteCharacterFromUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::DeleteSharedGroup(
@@ -326,24 +293,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeleteSharedGroup", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        DeleteSharedGroup(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnDeleteSharedGroupResult(CallRequestContainer& request)
+    void PlayFabServerAPI::DeleteSharedGroup(
+        PlayFabContext& context,
+        DeleteSharedGroupRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/DeleteSharedGroup", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::DeleteUsers(
@@ -353,24 +317,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeleteUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteUsersResult>(callback)), errorCallback, customData);
+        DeleteUsers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnDeleteUsersResult(CallRequestContainer& request)
+    void PlayFabServerAPI::DeleteUsers(
+        PlayFabContext& context,
+        DeleteUsersRequest& request,
+        ProcessApiCallback<DeleteUsersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeleteUsersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeleteUsersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/DeleteUsers", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<DeleteUsersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::DeregisterGame(
@@ -380,24 +341,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeregisterGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeregisterGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeregisterGameResponse>(callback)), errorCallback, customData);
+        DeregisterGame(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnDeregisterGameResult(CallRequestContainer& request)
+    void PlayFabServerAPI::DeregisterGame(
+        PlayFabContext& context,
+        DeregisterGameRequest& request,
+        ProcessApiCallback<DeregisterGameResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        DeregisterGameResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<DeregisterGameResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/DeregisterGame", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<DeregisterGameResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeregisterGameResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::EvaluateRandomResultTable(
@@ -407,24 +365,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/EvaluateRandomResultTable", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnEvaluateRandomResultTableResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EvaluateRandomResultTableResult>(callback)), errorCallback, customData);
+        EvaluateRandomResultTable(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnEvaluateRandomResultTableResult(CallRequestContainer& request)
+    void PlayFabServerAPI::EvaluateRandomResultTable(
+        PlayFabContext& context,
+        EvaluateRandomResultTableRequest& request,
+        ProcessApiCallback<EvaluateRandomResultTableResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EvaluateRandomResultTableResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EvaluateRandomResultTableResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/EvaluateRandomResultTable", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EvaluateRandomResultTableResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EvaluateRandomResultTableResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::ExecuteCloudScript(
@@ -434,24 +389,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ExecuteCloudScript", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnExecuteCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
+        ExecuteCloudScript(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnExecuteCloudScriptResult(CallRequestContainer& request)
+    void PlayFabServerAPI::ExecuteCloudScript(
+        PlayFabContext& context,
+        ExecuteCloudScriptServerRequest& request,
+        ProcessApiCallback<ExecuteCloudScriptResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ExecuteCloudScriptResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ExecuteCloudScriptResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/ExecuteCloudScript", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ExecuteCloudScriptResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetAllSegments(
@@ -461,24 +413,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetAllSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
+        GetAllSegments(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetAllSegmentsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetAllSegments(
+        PlayFabContext& context,
+        GetAllSegmentsRequest& request,
+        ProcessApiCallback<GetAllSegmentsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetAllSegmentsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetAllSegmentsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetAllSegments", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetAllSegmentsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetAllUsersCharacters(
@@ -488,24 +437,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetAllUsersCharacters", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllUsersCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
+        GetAllUsersCharacters(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetAllUsersCharactersResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetAllUsersCharacters(
+        PlayFabContext& context,
+        ListUsersCharactersRequest& request,
+        ProcessApiCallback<ListUsersCharactersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ListUsersCharactersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ListUsersCharactersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetAllUsersCharacters", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ListUsersCharactersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetCatalogItems(
@@ -515,24 +461,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
+        GetCatalogItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetCatalogItemsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetCatalogItems(
+        PlayFabContext& context,
+        GetCatalogItemsRequest& request,
+        ProcessApiCallback<GetCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCatalogItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCatalogItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetCatalogItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCatalogItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetCharacterData(
@@ -542,24 +485,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        GetCharacterData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetCharacterDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetCharacterData(
+        PlayFabContext& context,
+        GetCharacterDataRequest& request,
+        ProcessApiCallback<GetCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetCharacterData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetCharacterInternalData(
@@ -569,24 +509,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        GetCharacterInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetCharacterInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetCharacterInternalData(
+        PlayFabContext& context,
+        GetCharacterDataRequest& request,
+        ProcessApiCallback<GetCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetCharacterInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetCharacterInventory(
@@ -596,24 +533,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
+        GetCharacterInventory(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetCharacterInventoryResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetCharacterInventory(
+        PlayFabContext& context,
+        GetCharacterInventoryRequest& request,
+        ProcessApiCallback<GetCharacterInventoryResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterInventoryResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterInventoryResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetCharacterInventory", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCharacterInventoryResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetCharacterLeaderboard(
@@ -623,24 +557,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
+        GetCharacterLeaderboard(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetCharacterLeaderboardResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetCharacterLeaderboard(
+        PlayFabContext& context,
+        GetCharacterLeaderboardRequest& request,
+        ProcessApiCallback<GetCharacterLeaderboardResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterLeaderboardResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterLeaderboardResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetCharacterLeaderboard", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCharacterLeaderboardResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetCharacterReadOnlyData(
@@ -650,24 +581,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        GetCharacterReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetCharacterReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetCharacterReadOnlyData(
+        PlayFabContext& context,
+        GetCharacterDataRequest& request,
+        ProcessApiCallback<GetCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetCharacterReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetCharacterStatistics(
@@ -677,24 +605,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
+        GetCharacterStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetCharacterStatisticsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetCharacterStatistics(
+        PlayFabContext& context,
+        GetCharacterStatisticsRequest& request,
+        ProcessApiCallback<GetCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetCharacterStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetCharacterStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetCharacterStatistics", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetCharacterStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetContentDownloadUrl(
@@ -704,24 +629,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetContentDownloadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentDownloadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
+        GetContentDownloadUrl(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetContentDownloadUrlResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetContentDownloadUrl(
+        PlayFabContext& context,
+        GetContentDownloadUrlRequest& request,
+        ProcessApiCallback<GetContentDownloadUrlResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetContentDownloadUrlResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetContentDownloadUrlResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetContentDownloadUrl", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetContentDownloadUrlResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetFriendLeaderboard(
@@ -731,24 +653,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetFriendLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetFriendLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        GetFriendLeaderboard(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetFriendLeaderboardResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetFriendLeaderboard(
+        PlayFabContext& context,
+        GetFriendLeaderboardRequest& request,
+        ProcessApiCallback<GetLeaderboardResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetFriendLeaderboard", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetLeaderboardResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetFriendsList(
@@ -758,24 +677,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetFriendsList", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetFriendsListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
+        GetFriendsList(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetFriendsListResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetFriendsList(
+        PlayFabContext& context,
+        GetFriendsListRequest& request,
+        ProcessApiCallback<GetFriendsListResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetFriendsListResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetFriendsListResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetFriendsList", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetFriendsListResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetLeaderboard(
@@ -785,24 +701,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        GetLeaderboard(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetLeaderboardResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetLeaderboard(
+        PlayFabContext& context,
+        GetLeaderboardRequest& request,
+        ProcessApiCallback<GetLeaderboardResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetLeaderboard", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetLeaderboardResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetLeaderboardAroundCharacter(
@@ -812,24 +725,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboardAroundCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardAroundCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
+        GetLeaderboardAroundCharacter(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetLeaderboardAroundCharacterResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetLeaderboardAroundCharacter(
+        PlayFabContext& context,
+        GetLeaderboardAroundCharacterRequest& request,
+        ProcessApiCallback<GetLeaderboardAroundCharacterResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardAroundCharacterResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardAroundCharacterResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetLeaderboardAroundCharacter", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetLeaderboardAroundCharacterResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetLeaderboardAroundUser(
@@ -839,24 +749,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboardAroundUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardAroundUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundUserResult>(callback)), errorCallback, customData);
+        GetLeaderboardAroundUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetLeaderboardAroundUserResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetLeaderboardAroundUser(
+        PlayFabContext& context,
+        GetLeaderboardAroundUserRequest& request,
+        ProcessApiCallback<GetLeaderboardAroundUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardAroundUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardAroundUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetLeaderboardAroundUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetLeaderboardAroundUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetLeaderboardForUserCharacters(
@@ -866,24 +773,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboardForUserCharacters", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardForUserCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
+        GetLeaderboardForUserCharacters(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetLeaderboardForUserCharactersResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetLeaderboardForUserCharacters(
+        PlayFabContext& context,
+        GetLeaderboardForUsersCharactersRequest& request,
+        ProcessApiCallback<GetLeaderboardForUsersCharactersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetLeaderboardForUsersCharactersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetLeaderboardForUsersCharactersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetLeaderboardForUserCharacters", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetLeaderboardForUsersCharactersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayerCombinedInfo(
@@ -893,24 +797,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerCombinedInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerCombinedInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
+        GetPlayerCombinedInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayerCombinedInfoResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPlayerCombinedInfo(
+        PlayFabContext& context,
+        GetPlayerCombinedInfoRequest& request,
+        ProcessApiCallback<GetPlayerCombinedInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerCombinedInfoResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerCombinedInfoResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayerCombinedInfo", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerCombinedInfoResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayerProfile(
@@ -920,24 +821,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerProfile", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
+        GetPlayerProfile(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayerProfileResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPlayerProfile(
+        PlayFabContext& context,
+        GetPlayerProfileRequest& request,
+        ProcessApiCallback<GetPlayerProfileResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerProfileResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerProfileResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayerProfile", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerProfileResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayerSegments(
@@ -947,24 +845,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
+        GetPlayerSegments(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayerSegmentsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPlayerSegments(
+        PlayFabContext& context,
+        GetPlayersSegmentsRequest& request,
+        ProcessApiCallback<GetPlayerSegmentsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerSegmentsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerSegmentsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayerSegments", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerSegmentsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayersInSegment(
@@ -974,24 +869,21 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayersInSegment", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayersInSegmentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
+        GetPlayersInSegment(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayersInSegmentResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPlayersInSegment(
+        PlayFabContext& context,
+        GetPlayersInSegmentRequest& request,
+        ProcessApiCallback<GetPlayersInSegmentResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayersInSegmentResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayersInSegmentResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayersInSegment", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayersInSegmentResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayerStatistics(
@@ -1001,54 +893,59 @@ namespace PlayFab
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
+        GetPlayerStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayerStatisticsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPlayerStatistics(
+        PlayFabContext& context,
+        GetPlayerStatisticsRequest& request,
+        ProcessApiCallback<GetPlayerStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
 
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayerStatistics", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
+    }
+
+    void PlayFabServerAPI::GetPlayerStatisticVersions(
+        GetPlayerStatisticVersionsRequest& request,
+        ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        GetPlayerStatisticVersions(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayerStatisticVersions(
+        PlayFabContext& context,
         GetPlayerStatisticVersionsRequest& request,
         ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
         ErrorCallback errorCallback,
         void* customData
     )
     {
-
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerStatisticVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
-    }
-
-    void PlayFabServerAPI::OnGetPlayerStatisticVersionsResult(CallRequestContainer& request)
-    {
-        GetPlayerStatisticVersionsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticVersionsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayerStatisticVersions", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerStatisticVersionsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
+    }
+
+    void PlayFabServerAPI::GetPlayerTags(
+        GetPlayerTagsRequest& request,
+        ProcessApiCallback<GetPlayerTagsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        GetPlayerTags(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayerTags(
+        PlayFabContext& context,
         GetPlayerTagsRequest& request,
         ProcessApiCallback<GetPlayerTagsResult> callback,
         ErrorCallback errorCallback,
@@ -1056,26 +953,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayerTags", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayerTagsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayerTagsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(
+        GetPlayFabIDsFromFacebookIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayerTagsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayerTagsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetPlayFabIDsFromFacebookIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(
+        PlayFabContext& context,
         GetPlayFabIDsFromFacebookIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1083,26 +977,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayFabIDsFromFacebookIDs", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayFabIDsFromFacebookIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayFabIDsFromFacebookIDs", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromFacebookIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayFabIDsFromFacebookIDsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPlayFabIDsFromSteamIDs(
+        GetPlayFabIDsFromSteamIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromFacebookIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetPlayFabIDsFromSteamIDs(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPlayFabIDsFromSteamIDs(
+        PlayFabContext& context,
         GetPlayFabIDsFromSteamIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1110,26 +1001,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayFabIDsFromSteamIDs", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayFabIDsFromSteamIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPlayFabIDsFromSteamIDs", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPlayFabIDsFromSteamIDsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPlayFabIDsFromSteamIDsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetPublisherData(
+        GetPublisherDataRequest& request,
+        ProcessApiCallback<GetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPlayFabIDsFromSteamIDsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetPublisherData(
+        PlayFabContext& context,
         GetPublisherDataRequest& request,
         ProcessApiCallback<GetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -1137,26 +1025,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetPublisherDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetPublisherDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetRandomResultTables(
+        GetRandomResultTablesRequest& request,
+        ProcessApiCallback<GetRandomResultTablesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetPublisherDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetPublisherDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetRandomResultTables(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetRandomResultTables(
+        PlayFabContext& context,
         GetRandomResultTablesRequest& request,
         ProcessApiCallback<GetRandomResultTablesResult> callback,
         ErrorCallback errorCallback,
@@ -1164,26 +1049,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetRandomResultTables", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetRandomResultTablesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetRandomResultTablesResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetSharedGroupData(
+        GetSharedGroupDataRequest& request,
+        ProcessApiCallback<GetSharedGroupDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetRandomResultTablesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetRandomResultTablesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetSharedGroupData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetSharedGroupData(
+        PlayFabContext& context,
         GetSharedGroupDataRequest& request,
         ProcessApiCallback<GetSharedGroupDataResult> callback,
         ErrorCallback errorCallback,
@@ -1191,26 +1073,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetSharedGroupData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetSharedGroupData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetSharedGroupDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetSharedGroupDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetTime(
+        GetTimeRequest& request,
+        ProcessApiCallback<GetTimeResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetSharedGroupDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetSharedGroupDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetTime(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetTime(
+        PlayFabContext& context,
         GetTimeRequest& request,
         ProcessApiCallback<GetTimeResult> callback,
         ErrorCallback errorCallback,
@@ -1218,26 +1097,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTime", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTimeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetTime", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTimeResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetTimeResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetTitleData(
+        GetTitleDataRequest& request,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTimeResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTimeResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetTitleData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetTitleData(
+        PlayFabContext& context,
         GetTitleDataRequest& request,
         ProcessApiCallback<GetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -1245,26 +1121,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetTitleData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetTitleDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetTitleInternalData(
+        GetTitleDataRequest& request,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetTitleInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetTitleInternalData(
+        PlayFabContext& context,
         GetTitleDataRequest& request,
         ProcessApiCallback<GetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -1272,26 +1145,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetTitleInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetTitleInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetTitleNews(
+        GetTitleNewsRequest& request,
+        ProcessApiCallback<GetTitleNewsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetTitleNews(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetTitleNews(
+        PlayFabContext& context,
         GetTitleNewsRequest& request,
         ProcessApiCallback<GetTitleNewsResult> callback,
         ErrorCallback errorCallback,
@@ -1299,26 +1169,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTitleNews", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetTitleNews", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetTitleNewsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetTitleNewsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserAccountInfo(
+        GetUserAccountInfoRequest& request,
+        ProcessApiCallback<GetUserAccountInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetTitleNewsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetTitleNewsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserAccountInfo(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserAccountInfo(
+        PlayFabContext& context,
         GetUserAccountInfoRequest& request,
         ProcessApiCallback<GetUserAccountInfoResult> callback,
         ErrorCallback errorCallback,
@@ -1326,26 +1193,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserAccountInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserAccountInfoResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserAccountInfo", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserAccountInfoResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserAccountInfoResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserAccountInfoResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserBans(
+        GetUserBansRequest& request,
+        ProcessApiCallback<GetUserBansResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserAccountInfoResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserAccountInfoResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserBans(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserBans(
+        PlayFabContext& context,
         GetUserBansRequest& request,
         ProcessApiCallback<GetUserBansResult> callback,
         ErrorCallback errorCallback,
@@ -1353,26 +1217,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserBans", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserBansResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserBansResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserData(
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserBansResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserBansResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserData(
+        PlayFabContext& context,
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1380,26 +1241,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserInternalData(
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserInternalData(
+        PlayFabContext& context,
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1407,26 +1265,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserInventory(
+        GetUserInventoryRequest& request,
+        ProcessApiCallback<GetUserInventoryResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserInventory(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserInventory(
+        PlayFabContext& context,
         GetUserInventoryRequest& request,
         ProcessApiCallback<GetUserInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -1434,26 +1289,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserInventory", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserInventoryResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserInventoryResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserPublisherData(
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserInventoryResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserInventoryResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserPublisherData(
+        PlayFabContext& context,
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1461,26 +1313,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserPublisherDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserPublisherInternalData(
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserPublisherInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserPublisherInternalData(
+        PlayFabContext& context,
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1488,26 +1337,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserPublisherInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserPublisherInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserPublisherReadOnlyData(
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserPublisherReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserPublisherReadOnlyData(
+        PlayFabContext& context,
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1515,26 +1361,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserPublisherReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserPublisherReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GetUserReadOnlyData(
+        GetUserDataRequest& request,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GetUserReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GetUserReadOnlyData(
+        PlayFabContext& context,
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1542,26 +1385,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GetUserReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GetUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGetUserReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GrantCharacterToUser(
+        GrantCharacterToUserRequest& request,
+        ProcessApiCallback<GrantCharacterToUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GetUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GrantCharacterToUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GrantCharacterToUser(
+        PlayFabContext& context,
         GrantCharacterToUserRequest& request,
         ProcessApiCallback<GrantCharacterToUserResult> callback,
         ErrorCallback errorCallback,
@@ -1569,26 +1409,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantCharacterToUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantCharacterToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GrantCharacterToUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GrantCharacterToUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGrantCharacterToUserResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GrantItemsToCharacter(
+        GrantItemsToCharacterRequest& request,
+        ProcessApiCallback<GrantItemsToCharacterResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GrantCharacterToUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GrantCharacterToUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GrantItemsToCharacter(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GrantItemsToCharacter(
+        PlayFabContext& context,
         GrantItemsToCharacterRequest& request,
         ProcessApiCallback<GrantItemsToCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -1596,26 +1433,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantItemsToCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToCharacterResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GrantItemsToCharacter", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GrantItemsToCharacterResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToCharacterResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGrantItemsToCharacterResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GrantItemsToUser(
+        GrantItemsToUserRequest& request,
+        ProcessApiCallback<GrantItemsToUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GrantItemsToCharacterResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GrantItemsToCharacterResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GrantItemsToUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GrantItemsToUser(
+        PlayFabContext& context,
         GrantItemsToUserRequest& request,
         ProcessApiCallback<GrantItemsToUserResult> callback,
         ErrorCallback errorCallback,
@@ -1623,26 +1457,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantItemsToUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUserResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GrantItemsToUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GrantItemsToUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUserResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGrantItemsToUserResult(CallRequestContainer& request)
+    void PlayFabServerAPI::GrantItemsToUsers(
+        GrantItemsToUsersRequest& request,
+        ProcessApiCallback<GrantItemsToUsersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GrantItemsToUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GrantItemsToUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        GrantItemsToUsers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::GrantItemsToUsers(
+        PlayFabContext& context,
         GrantItemsToUsersRequest& request,
         ProcessApiCallback<GrantItemsToUsersResult> callback,
         ErrorCallback errorCallback,
@@ -1650,26 +1481,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantItemsToUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/GrantItemsToUsers", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<GrantItemsToUsersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnGrantItemsToUsersResult(CallRequestContainer& request)
+    void PlayFabServerAPI::ModifyItemUses(
+        ModifyItemUsesRequest& request,
+        ProcessApiCallback<ModifyItemUsesResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        GrantItemsToUsersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<GrantItemsToUsersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ModifyItemUses(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::ModifyItemUses(
+        PlayFabContext& context,
         ModifyItemUsesRequest& request,
         ProcessApiCallback<ModifyItemUsesResult> callback,
         ErrorCallback errorCallback,
@@ -1677,26 +1505,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ModifyItemUses", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyItemUsesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyItemUsesResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/ModifyItemUses", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyItemUsesResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyItemUsesResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnModifyItemUsesResult(CallRequestContainer& request)
+    void PlayFabServerAPI::MoveItemToCharacterFromCharacter(
+        MoveItemToCharacterFromCharacterRequest& request,
+        ProcessApiCallback<MoveItemToCharacterFromCharacterResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyItemUsesResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyItemUsesResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        MoveItemToCharacterFromCharacter(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::MoveItemToCharacterFromCharacter(
+        PlayFabContext& context,
         MoveItemToCharacterFromCharacterRequest& request,
         ProcessApiCallback<MoveItemToCharacterFromCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -1704,26 +1529,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/MoveItemToCharacterFromCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToCharacterFromCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromCharacterResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/MoveItemToCharacterFromCharacter", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<MoveItemToCharacterFromCharacterResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromCharacterResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnMoveItemToCharacterFromCharacterResult(CallRequestContainer& request)
+    void PlayFabServerAPI::MoveItemToCharacterFromUser(
+        MoveItemToCharacterFromUserRequest& request,
+        ProcessApiCallback<MoveItemToCharacterFromUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        MoveItemToCharacterFromCharacterResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<MoveItemToCharacterFromCharacterResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        MoveItemToCharacterFromUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::MoveItemToCharacterFromUser(
+        PlayFabContext& context,
         MoveItemToCharacterFromUserRequest& request,
         ProcessApiCallback<MoveItemToCharacterFromUserResult> callback,
         ErrorCallback errorCallback,
@@ -1731,26 +1553,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/MoveItemToCharacterFromUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToCharacterFromUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromUserResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/MoveItemToCharacterFromUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<MoveItemToCharacterFromUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromUserResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnMoveItemToCharacterFromUserResult(CallRequestContainer& request)
+    void PlayFabServerAPI::MoveItemToUserFromCharacter(
+        MoveItemToUserFromCharacterRequest& request,
+        ProcessApiCallback<MoveItemToUserFromCharacterResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        MoveItemToCharacterFromUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<MoveItemToCharacterFromUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        MoveItemToUserFromCharacter(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::MoveItemToUserFromCharacter(
+        PlayFabContext& context,
         MoveItemToUserFromCharacterRequest& request,
         ProcessApiCallback<MoveItemToUserFromCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -1758,26 +1577,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/MoveItemToUserFromCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToUserFromCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToUserFromCharacterResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/MoveItemToUserFromCharacter", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<MoveItemToUserFromCharacterResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToUserFromCharacterResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnMoveItemToUserFromCharacterResult(CallRequestContainer& request)
+    void PlayFabServerAPI::NotifyMatchmakerPlayerLeft(
+        NotifyMatchmakerPlayerLeftRequest& request,
+        ProcessApiCallback<NotifyMatchmakerPlayerLeftResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        MoveItemToUserFromCharacterResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<MoveItemToUserFromCharacterResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        NotifyMatchmakerPlayerLeft(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::NotifyMatchmakerPlayerLeft(
+        PlayFabContext& context,
         NotifyMatchmakerPlayerLeftRequest& request,
         ProcessApiCallback<NotifyMatchmakerPlayerLeftResult> callback,
         ErrorCallback errorCallback,
@@ -1785,26 +1601,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/NotifyMatchmakerPlayerLeft", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnNotifyMatchmakerPlayerLeftResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<NotifyMatchmakerPlayerLeftResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/NotifyMatchmakerPlayerLeft", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<NotifyMatchmakerPlayerLeftResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<NotifyMatchmakerPlayerLeftResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnNotifyMatchmakerPlayerLeftResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RedeemCoupon(
+        RedeemCouponRequest& request,
+        ProcessApiCallback<RedeemCouponResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        NotifyMatchmakerPlayerLeftResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<NotifyMatchmakerPlayerLeftResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RedeemCoupon(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RedeemCoupon(
+        PlayFabContext& context,
         RedeemCouponRequest& request,
         ProcessApiCallback<RedeemCouponResult> callback,
         ErrorCallback errorCallback,
@@ -1812,26 +1625,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RedeemCoupon", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRedeemCouponResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RedeemCoupon", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RedeemCouponResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRedeemCouponResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RedeemMatchmakerTicket(
+        RedeemMatchmakerTicketRequest& request,
+        ProcessApiCallback<RedeemMatchmakerTicketResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RedeemCouponResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RedeemCouponResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RedeemMatchmakerTicket(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RedeemMatchmakerTicket(
+        PlayFabContext& context,
         RedeemMatchmakerTicketRequest& request,
         ProcessApiCallback<RedeemMatchmakerTicketResult> callback,
         ErrorCallback errorCallback,
@@ -1839,26 +1649,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RedeemMatchmakerTicket", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRedeemMatchmakerTicketResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemMatchmakerTicketResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RedeemMatchmakerTicket", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RedeemMatchmakerTicketResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemMatchmakerTicketResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRedeemMatchmakerTicketResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RefreshGameServerInstanceHeartbeat(
+        RefreshGameServerInstanceHeartbeatRequest& request,
+        ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RedeemMatchmakerTicketResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RedeemMatchmakerTicketResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RefreshGameServerInstanceHeartbeat(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RefreshGameServerInstanceHeartbeat(
+        PlayFabContext& context,
         RefreshGameServerInstanceHeartbeatRequest& request,
         ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult> callback,
         ErrorCallback errorCallback,
@@ -1866,26 +1673,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RefreshGameServerInstanceHeartbeat", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRefreshGameServerInstanceHeartbeatResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RefreshGameServerInstanceHeartbeat", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RefreshGameServerInstanceHeartbeatResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRefreshGameServerInstanceHeartbeatResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RegisterGame(
+        RegisterGameRequest& request,
+        ProcessApiCallback<RegisterGameResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RefreshGameServerInstanceHeartbeatResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RegisterGame(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RegisterGame(
+        PlayFabContext& context,
         RegisterGameRequest& request,
         ProcessApiCallback<RegisterGameResponse> callback,
         ErrorCallback errorCallback,
@@ -1893,26 +1697,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RegisterGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRegisterGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterGameResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RegisterGame", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RegisterGameResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterGameResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRegisterGameResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RemoveFriend(
+        RemoveFriendRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RegisterGameResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RegisterGameResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemoveFriend(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RemoveFriend(
+        PlayFabContext& context,
         RemoveFriendRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -1920,26 +1721,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RemoveFriend", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RemoveFriend", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRemoveFriendResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RemovePlayerTag(
+        RemovePlayerTagRequest& request,
+        ProcessApiCallback<RemovePlayerTagResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemovePlayerTag(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RemovePlayerTag(
+        PlayFabContext& context,
         RemovePlayerTagRequest& request,
         ProcessApiCallback<RemovePlayerTagResult> callback,
         ErrorCallback errorCallback,
@@ -1947,26 +1745,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RemovePlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemovePlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RemovePlayerTag", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RemovePlayerTagResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRemovePlayerTagResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RemoveSharedGroupMembers(
+        RemoveSharedGroupMembersRequest& request,
+        ProcessApiCallback<RemoveSharedGroupMembersResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemovePlayerTagResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemovePlayerTagResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RemoveSharedGroupMembers(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RemoveSharedGroupMembers(
+        PlayFabContext& context,
         RemoveSharedGroupMembersRequest& request,
         ProcessApiCallback<RemoveSharedGroupMembersResult> callback,
         ErrorCallback errorCallback,
@@ -1974,26 +1769,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RemoveSharedGroupMembers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RemoveSharedGroupMembers", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RemoveSharedGroupMembersResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRemoveSharedGroupMembersResult(CallRequestContainer& request)
+    void PlayFabServerAPI::ReportPlayer(
+        ReportPlayerServerRequest& request,
+        ProcessApiCallback<ReportPlayerServerResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RemoveSharedGroupMembersResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RemoveSharedGroupMembersResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        ReportPlayer(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::ReportPlayer(
+        PlayFabContext& context,
         ReportPlayerServerRequest& request,
         ProcessApiCallback<ReportPlayerServerResult> callback,
         ErrorCallback errorCallback,
@@ -2001,26 +1793,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ReportPlayer", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnReportPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerServerResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/ReportPlayer", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ReportPlayerServerResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerServerResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnReportPlayerResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RevokeAllBansForUser(
+        RevokeAllBansForUserRequest& request,
+        ProcessApiCallback<RevokeAllBansForUserResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ReportPlayerServerResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ReportPlayerServerResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeAllBansForUser(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RevokeAllBansForUser(
+        PlayFabContext& context,
         RevokeAllBansForUserRequest& request,
         ProcessApiCallback<RevokeAllBansForUserResult> callback,
         ErrorCallback errorCallback,
@@ -2028,26 +1817,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeAllBansForUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeAllBansForUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RevokeAllBansForUser", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeAllBansForUserResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRevokeAllBansForUserResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RevokeBans(
+        RevokeBansRequest& request,
+        ProcessApiCallback<RevokeBansResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeAllBansForUserResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeAllBansForUserResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeBans(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RevokeBans(
+        PlayFabContext& context,
         RevokeBansRequest& request,
         ProcessApiCallback<RevokeBansResult> callback,
         ErrorCallback errorCallback,
@@ -2055,26 +1841,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RevokeBans", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeBansResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRevokeBansResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RevokeInventoryItem(
+        RevokeInventoryItemRequest& request,
+        ProcessApiCallback<RevokeInventoryResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeBansResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeBansResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeInventoryItem(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RevokeInventoryItem(
+        PlayFabContext& context,
         RevokeInventoryItemRequest& request,
         ProcessApiCallback<RevokeInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -2082,26 +1865,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeInventoryItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RevokeInventoryItem", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeInventoryResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRevokeInventoryItemResult(CallRequestContainer& request)
+    void PlayFabServerAPI::RevokeInventoryItems(
+        RevokeInventoryItemsRequest& request,
+        ProcessApiCallback<RevokeInventoryItemsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeInventoryResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeInventoryResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        RevokeInventoryItems(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::RevokeInventoryItems(
+        PlayFabContext& context,
         RevokeInventoryItemsRequest& request,
         ProcessApiCallback<RevokeInventoryItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2109,26 +1889,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeInventoryItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/RevokeInventoryItems", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<RevokeInventoryItemsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnRevokeInventoryItemsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SendCustomAccountRecoveryEmail(
+        SendCustomAccountRecoveryEmailRequest& request,
+        ProcessApiCallback<SendCustomAccountRecoveryEmailResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        RevokeInventoryItemsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<RevokeInventoryItemsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SendCustomAccountRecoveryEmail(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SendCustomAccountRecoveryEmail(
+        PlayFabContext& context,
         SendCustomAccountRecoveryEmailRequest& request,
         ProcessApiCallback<SendCustomAccountRecoveryEmailResult> callback,
         ErrorCallback errorCallback,
@@ -2136,26 +1913,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SendCustomAccountRecoveryEmail", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendCustomAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendCustomAccountRecoveryEmailResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SendCustomAccountRecoveryEmail", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SendCustomAccountRecoveryEmailResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendCustomAccountRecoveryEmailResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSendCustomAccountRecoveryEmailResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SendEmailFromTemplate(
+        SendEmailFromTemplateRequest& request,
+        ProcessApiCallback<SendEmailFromTemplateResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SendCustomAccountRecoveryEmailResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SendCustomAccountRecoveryEmailResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SendEmailFromTemplate(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SendEmailFromTemplate(
+        PlayFabContext& context,
         SendEmailFromTemplateRequest& request,
         ProcessApiCallback<SendEmailFromTemplateResult> callback,
         ErrorCallback errorCallback,
@@ -2163,26 +1937,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SendEmailFromTemplate", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendEmailFromTemplateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendEmailFromTemplateResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SendEmailFromTemplate", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SendEmailFromTemplateResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendEmailFromTemplateResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSendEmailFromTemplateResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SendPushNotification(
+        SendPushNotificationRequest& request,
+        ProcessApiCallback<SendPushNotificationResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SendEmailFromTemplateResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SendEmailFromTemplateResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SendPushNotification(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SendPushNotification(
+        PlayFabContext& context,
         SendPushNotificationRequest& request,
         ProcessApiCallback<SendPushNotificationResult> callback,
         ErrorCallback errorCallback,
@@ -2190,26 +1961,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SendPushNotification", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendPushNotificationResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SendPushNotification", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SendPushNotificationResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendPushNotificationResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSendPushNotificationResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetFriendTags(
+        SetFriendTagsRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SendPushNotificationResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SendPushNotificationResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetFriendTags(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetFriendTags(
+        PlayFabContext& context,
         SetFriendTagsRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2217,26 +1985,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetFriendTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetFriendTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetFriendTags", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetFriendTagsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetGameServerInstanceData(
+        SetGameServerInstanceDataRequest& request,
+        ProcessApiCallback<SetGameServerInstanceDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetGameServerInstanceData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetGameServerInstanceData(
+        PlayFabContext& context,
         SetGameServerInstanceDataRequest& request,
         ProcessApiCallback<SetGameServerInstanceDataResult> callback,
         ErrorCallback errorCallback,
@@ -2244,26 +2009,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetGameServerInstanceData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetGameServerInstanceData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetGameServerInstanceDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetGameServerInstanceDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetGameServerInstanceState(
+        SetGameServerInstanceStateRequest& request,
+        ProcessApiCallback<SetGameServerInstanceStateResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetGameServerInstanceDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetGameServerInstanceDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetGameServerInstanceState(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetGameServerInstanceState(
+        PlayFabContext& context,
         SetGameServerInstanceStateRequest& request,
         ProcessApiCallback<SetGameServerInstanceStateResult> callback,
         ErrorCallback errorCallback,
@@ -2271,26 +2033,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetGameServerInstanceState", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceStateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceStateResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetGameServerInstanceState", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetGameServerInstanceStateResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceStateResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetGameServerInstanceStateResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetGameServerInstanceTags(
+        SetGameServerInstanceTagsRequest& request,
+        ProcessApiCallback<SetGameServerInstanceTagsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetGameServerInstanceStateResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetGameServerInstanceStateResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetGameServerInstanceTags(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetGameServerInstanceTags(
+        PlayFabContext& context,
         SetGameServerInstanceTagsRequest& request,
         ProcessApiCallback<SetGameServerInstanceTagsResult> callback,
         ErrorCallback errorCallback,
@@ -2298,26 +2057,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetGameServerInstanceTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceTagsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetGameServerInstanceTags", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetGameServerInstanceTagsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceTagsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetGameServerInstanceTagsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetPlayerSecret(
+        SetPlayerSecretRequest& request,
+        ProcessApiCallback<SetPlayerSecretResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetGameServerInstanceTagsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetGameServerInstanceTagsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetPlayerSecret(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetPlayerSecret(
+        PlayFabContext& context,
         SetPlayerSecretRequest& request,
         ProcessApiCallback<SetPlayerSecretResult> callback,
         ErrorCallback errorCallback,
@@ -2325,26 +2081,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetPlayerSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetPlayerSecret", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetPlayerSecretResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetPlayerSecretResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetPublisherData(
+        SetPublisherDataRequest& request,
+        ProcessApiCallback<SetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetPlayerSecretResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetPlayerSecretResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetPublisherData(
+        PlayFabContext& context,
         SetPublisherDataRequest& request,
         ProcessApiCallback<SetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -2352,26 +2105,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetPublisherDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetPublisherDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetTitleData(
+        SetTitleDataRequest& request,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetPublisherDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetPublisherDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetTitleData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetTitleData(
+        PlayFabContext& context,
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2379,26 +2129,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetTitleData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetTitleDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SetTitleInternalData(
+        SetTitleDataRequest& request,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SetTitleInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SetTitleInternalData(
+        PlayFabContext& context,
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2406,26 +2153,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SetTitleInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<SetTitleDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSetTitleInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SubtractCharacterVirtualCurrency(
+        SubtractCharacterVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyCharacterVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        SetTitleDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SubtractCharacterVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SubtractCharacterVirtualCurrency(
+        PlayFabContext& context,
         SubtractCharacterVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyCharacterVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2433,26 +2177,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SubtractCharacterVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractCharacterVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SubtractCharacterVirtualCurrency", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyCharacterVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSubtractCharacterVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabServerAPI::SubtractUserVirtualCurrency(
+        SubtractUserVirtualCurrencyRequest& request,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyCharacterVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyCharacterVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        SubtractUserVirtualCurrency(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::SubtractUserVirtualCurrency(
+        PlayFabContext& context,
         SubtractUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2460,26 +2201,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SubtractUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/SubtractUserVirtualCurrency", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<ModifyUserVirtualCurrencyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnSubtractUserVirtualCurrencyResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UnlockContainerInstance(
+        UnlockContainerInstanceRequest& request,
+        ProcessApiCallback<UnlockContainerItemResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        ModifyUserVirtualCurrencyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlockContainerInstance(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UnlockContainerInstance(
+        PlayFabContext& context,
         UnlockContainerInstanceRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -2487,26 +2225,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UnlockContainerInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUnlockContainerInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UnlockContainerInstance", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UnlockContainerItemResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUnlockContainerInstanceResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UnlockContainerItem(
+        UnlockContainerItemRequest& request,
+        ProcessApiCallback<UnlockContainerItemResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlockContainerItemResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlockContainerItemResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UnlockContainerItem(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UnlockContainerItem(
+        PlayFabContext& context,
         UnlockContainerItemRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -2514,26 +2249,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UnlockContainerItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUnlockContainerItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UnlockContainerItem", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UnlockContainerItemResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUnlockContainerItemResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateAvatarUrl(
+        UpdateAvatarUrlRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UnlockContainerItemResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UnlockContainerItemResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateAvatarUrl(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateAvatarUrl(
+        PlayFabContext& context,
         UpdateAvatarUrlRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2541,26 +2273,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateAvatarUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateAvatarUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateAvatarUrl", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateAvatarUrlResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateBans(
+        UpdateBansRequest& request,
+        ProcessApiCallback<UpdateBansResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateBans(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateBans(
+        PlayFabContext& context,
         UpdateBansRequest& request,
         ProcessApiCallback<UpdateBansResult> callback,
         ErrorCallback errorCallback,
@@ -2568,26 +2297,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateBans", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateBansResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateBansResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateCharacterData(
+        UpdateCharacterDataRequest& request,
+        ProcessApiCallback<UpdateCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateBansResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateBansResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCharacterData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateCharacterData(
+        PlayFabContext& context,
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -2595,26 +2321,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateCharacterData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateCharacterDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateCharacterInternalData(
+        UpdateCharacterDataRequest& request,
+        ProcessApiCallback<UpdateCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCharacterInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateCharacterInternalData(
+        PlayFabContext& context,
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -2622,26 +2345,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateCharacterInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateCharacterInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateCharacterReadOnlyData(
+        UpdateCharacterDataRequest& request,
+        ProcessApiCallback<UpdateCharacterDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCharacterReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateCharacterReadOnlyData(
+        PlayFabContext& context,
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -2649,26 +2369,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateCharacterReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateCharacterDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateCharacterReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateCharacterStatistics(
+        UpdateCharacterStatisticsRequest& request,
+        ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCharacterDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCharacterDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateCharacterStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateCharacterStatistics(
+        PlayFabContext& context,
         UpdateCharacterStatisticsRequest& request,
         ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -2676,26 +2393,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateCharacterStatistics", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateCharacterStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateCharacterStatisticsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdatePlayerStatistics(
+        UpdatePlayerStatisticsRequest& request,
+        ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateCharacterStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateCharacterStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdatePlayerStatistics(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdatePlayerStatistics(
+        PlayFabContext& context,
         UpdatePlayerStatisticsRequest& request,
         ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -2703,26 +2417,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdatePlayerStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdatePlayerStatistics", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdatePlayerStatisticsResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdatePlayerStatisticsResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateSharedGroupData(
+        UpdateSharedGroupDataRequest& request,
+        ProcessApiCallback<UpdateSharedGroupDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdatePlayerStatisticsResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdatePlayerStatisticsResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateSharedGroupData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateSharedGroupData(
+        PlayFabContext& context,
         UpdateSharedGroupDataRequest& request,
         ProcessApiCallback<UpdateSharedGroupDataResult> callback,
         ErrorCallback errorCallback,
@@ -2730,26 +2441,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateSharedGroupData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateSharedGroupData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateSharedGroupDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateSharedGroupDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateUserData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateSharedGroupDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateSharedGroupDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateUserData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2757,26 +2465,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateUserData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateUserDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateUserInternalData(
+        UpdateUserInternalDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateUserInternalData(
+        PlayFabContext& context,
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2784,26 +2489,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateUserInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateUserInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateUserInventoryItemCustomData(
+        UpdateUserInventoryItemDataRequest& request,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserInventoryItemCustomData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateUserInventoryItemCustomData(
+        PlayFabContext& context,
         UpdateUserInventoryItemDataRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2811,26 +2513,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserInventoryItemCustomData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInventoryItemCustomDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateUserInventoryItemCustomData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<EmptyResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateUserInventoryItemCustomDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateUserPublisherData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        EmptyResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserPublisherData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateUserPublisherData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2838,26 +2537,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateUserPublisherData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateUserPublisherDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateUserPublisherInternalData(
+        UpdateUserInternalDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserPublisherInternalData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateUserPublisherInternalData(
+        PlayFabContext& context,
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2865,26 +2561,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateUserPublisherInternalData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateUserPublisherInternalDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateUserPublisherReadOnlyData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserPublisherReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateUserPublisherReadOnlyData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2892,26 +2585,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateUserPublisherReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateUserPublisherReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::UpdateUserReadOnlyData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        UpdateUserReadOnlyData(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::UpdateUserReadOnlyData(
+        PlayFabContext& context,
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2919,26 +2609,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/UpdateUserReadOnlyData", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<UpdateUserDataResult>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnUpdateUserReadOnlyDataResult(CallRequestContainer& request)
+    void PlayFabServerAPI::WriteCharacterEvent(
+        WriteServerCharacterEventRequest& request,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        UpdateUserDataResult outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        WriteCharacterEvent(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::WriteCharacterEvent(
+        PlayFabContext& context,
         WriteServerCharacterEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -2946,26 +2633,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/WriteCharacterEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWriteCharacterEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/WriteCharacterEvent", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<WriteEventResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnWriteCharacterEventResult(CallRequestContainer& request)
+    void PlayFabServerAPI::WritePlayerEvent(
+        WriteServerPlayerEventRequest& request,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        WriteEventResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        WritePlayerEvent(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::WritePlayerEvent(
+        PlayFabContext& context,
         WriteServerPlayerEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -2973,26 +2657,23 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/WritePlayerEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWritePlayerEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/WritePlayerEvent", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<WriteEventResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnWritePlayerEventResult(CallRequestContainer& request)
+    void PlayFabServerAPI::WriteTitleEvent(
+        WriteTitleEventRequest& request,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        WriteEventResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
+        WriteTitleEvent(PlayFabContext::Default(), request, callback, errorCallback, customData);
     }
 
     void PlayFabServerAPI::WriteTitleEvent(
+        PlayFabContext& context,
         WriteTitleEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3000,24 +2681,11 @@ namespace PlayFab
     )
     {
 
-        IPlayFabHttp& http = IPlayFabHttp::Get();
-        const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/WriteTitleEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWriteTitleEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        IPlayFabHttp& http = context.GetHttp();
+        auto requestJson = request.ToJson();
+        http.AddRequest("/Server/WriteTitleEvent", "X-SecretKey", context.GetDeveloperSecretKey(), std::move(requestJson), DispatchResult<WriteEventResponse>, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
-    void PlayFabServerAPI::OnWriteTitleEventResult(CallRequestContainer& request)
-    {
-        WriteEventResponse outResult;
-        outResult.FromJson(request.errorWrapper.Data);
-        outResult.Request = request.errorWrapper.Request;
-
-        const auto internalPtr = request.successCallback.get();
-        if (internalPtr != nullptr)
-        {
-            const auto callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr));
-            callback(outResult, request.customData);
-        }
-    }
 }
 
 #endif
@@ -1,6 +1,7 @@
 #include <gsdkCommonPch.h>
 
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabEntityTokenManager.h>
 
 namespace PlayFab
 {
@@ -10,6 +11,7 @@ namespace PlayFab
 
     bool PlayFabSettings::useDevelopmentEnvironment = false;
     std::string PlayFabSettings::serverURL;
+    std::once_flag PlayFabSettings::serverURLBuilt;
     std::string PlayFabSettings::developmentEnvironmentURL = ".playfabsandbox.com";
     std::string PlayFabSettings::productionEnvironmentURL = ".playfabapi.com";
     std::string PlayFabSettings::titleId; // You must set this value for PlayFabSdk to work properly (Found in the Game Manager for your title, at the PlayFab Website)
@@ -18,7 +20,19 @@ namespace PlayFab
     // Control whether all callbacks are threaded or whether the user manually controlls callback timing from their main-thread
     bool PlayFabSettings::threadedCallbacks = false;
 
-    std::string PlayFabSettings::entityToken; // This is set by entity GetEntityToken method, and is required by all other Entity API methods
+    PlayFabSettings::EntityTokenForwarder PlayFabSettings::entityToken;
+
+    // Number of PlayFabHttp worker threads, which bounds how many requests are in flight at once. Read when the http instance is created, so set it before the first API call
+    size_t PlayFabSettings::maxConcurrentRequests = 1;
+
+    // Whether results and errors keep a reference to the request json they were sent with. Turn off to release request payloads as soon as they are sent
+    bool PlayFabSettings::keepRequestJson = true;
+
+    // With threadedCallbacks, callbacks run on this many PlayFabHttp callback threads, so slow callbacks never hold up the requests behind them
+    size_t PlayFabSettings::callbackThreads = 2;
+    // With threadedCallbacks, hands callbacks to this executor instead of the callback threads, e.g. the game's own thread pool
+    CallbackExecutor PlayFabSettings::callbackExecutor = nullptr;
+
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
     std::string PlayFabSettings::developerSecretKey; // You must set this value for PlayFabSdk to work properly (Found in the Game Manager for your title, at the PlayFab Website)
 #endif
@@ -35,14 +49,33 @@ namespace PlayFab
 
     void PlayFabSettings::ForgetAllCredentials()
     {
-        entityToken.clear();
+        PlayFabEntityTokenManager::ClearToken();
         clientSessionTicket.clear();
     }
 
+    PlayFabSettings::EntityTokenForwarder::operator std::string() const
+    {
+        return PlayFabEntityTokenManager::GetToken()->token;
+    }
+
+    PlayFabSettings::EntityTokenForwarder& PlayFabSettings::EntityTokenForwarder::operator=(const std::string& token)
+    {
+        PlayFabEntityTokenManager::SetToken(token);
+        return *this;
+    }
+
+    bool PlayFabSettings::EntityTokenForwarder::empty() const
+    {
+        return PlayFabEntityTokenManager::GetToken()->token.empty();
+    }
+
     std::string PlayFabSettings::GetUrl(const std::string& urlPath)
     {
-        if (serverURL.length() == 0)
+        // Every PlayFabHttp worker can get here at once, so only one of them may build it
+        std::call_once(serverURLBuilt, []()
+        {
             serverURL = "https://" + titleId + (useDevelopmentEnvironment ? developmentEnvironmentURL : productionEnvironmentURL);
+        });
         return serverURL + urlPath;
     }
 }
@@ -0,0 +1,376 @@
+#include <gsdkCommonPch.h>
+
+#ifdef ENABLE_PLAYFABSERVER_API
+
+#include <playfab/PlayFabWriteBehind.h>
+#include <playfab/PlayFabSettings.h>
+#include <gsdk.h>
+
+namespace PlayFab
+{
+    using namespace ServerModels;
+
+    // UpdateUserData accepts at most this many keys per call, so larger batches are split
+    constexpr size_t c_maxUserDataKeysPerRequest = 10;
+    // Retry delays stop doubling after this many failed rounds
+    constexpr unsigned int c_maxRetryDoublings = 5;
+
+    std::mutex PlayFabWriteBehind::bufferMutex;
+    std::condition_variable PlayFabWriteBehind::flushCondition;
+    std::condition_variable PlayFabWriteBehind::requestsCompleteCondition;
+    std::unordered_map<std::string, PlayFabWriteBehind::PendingPlayerUpdates> PlayFabWriteBehind::pendingUpdates;
+    size_t PlayFabWriteBehind::pendingUpdateCount = 0;
+    size_t PlayFabWriteBehind::requestsInFlight = 0;
+    size_t PlayFabWriteBehind::transientFailureCount = 0;
+    bool PlayFabWriteBehind::flushRequested = false;
+    bool PlayFabWriteBehind::flushThreadRunning = false;
+    std::thread PlayFabWriteBehind::flushThread;
+    PlayFabWriteBehindSettings PlayFabWriteBehind::writeBehindSettings;
+    Microsoft::Azure::Gaming::GSDKSubscriptionId PlayFabWriteBehind::shutdownSubscription = 0;
+
+    void PlayFabWriteBehind::Start(const PlayFabWriteBehindSettings& settings)
+    {
+        std::unique_lock<std::mutex> lock(bufferMutex);
+        writeBehindSettings = settings;
+
+        if (!flushThreadRunning)
+        {
+            flushThreadRunning = true;
+            flushThread = std::thread(&PlayFabWriteBehind::FlushThread);
+        }
+
+        // Inline, so the flush holds up the game's shutdown callback rather than racing it.
+        // Only once the game has started the GSDK, as subscribing would otherwise start it.
+        if (settings.flushOnShutdown && shutdownSubscription == 0 && Microsoft::Azure::Gaming::GSDK::isStarted())
+        {
+            using namespace Microsoft::Azure::Gaming;
+            shutdownSubscription = GSDK::subscribe(GSDKEventType::Shutdown, [](const GSDKEvent&)
+            {
+                unsigned int timeoutMs;
+                { // LOCK bufferMutex
+                    std::unique_lock<std::mutex> lock(bufferMutex);
+                    timeoutMs = writeBehindSettings.shutdownFlushTimeoutMs;
+                } // UNLOCK bufferMutex
+
+                // Waiting for the results would mean pumping the game's PlayFab callbacks on the GSDK's thread, so only send them
+                if (PlayFabSettings::threadedCallbacks)
+                    FlushAndWait(timeoutMs);
+                else
+                    Flush();
+            }, GSDKEventExecutor::Inline);
+        }
+        else if (!settings.flushOnShutdown && shutdownSubscription != 0)
+        {
+            Microsoft::Azure::Gaming::GSDK::unsubscribe(shutdownSubscription);
+            shutdownSubscription = 0;
+        }
+    }
+
+    void PlayFabWriteBehind::Stop(unsigned int timeoutMs)
+    {
+        Microsoft::Azure::Gaming::GSDKSubscriptionId subscription;
+        { // LOCK bufferMutex
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            flushThreadRunning = false;
+            subscription = shutdownSubscription;
+            shutdownSubscription = 0;
+        } // UNLOCK bufferMutex
+
+        if (subscription != 0)
+            Microsoft::Azure::Gaming::GSDK::unsubscribe(subscription);
+
+        flushCondition.notify_all();
+        if (flushThread.joinable())
+            flushThread.join();
+
+        FlushAndWait(timeoutMs);
+    }
+
+    void PlayFabWriteBehind::SetStatistic(const std::string& playFabId, const std::string& statisticName, Int32 value)
+    {
+        std::unique_lock<std::mutex> lock(bufferMutex);
+
+        auto& statistics = pendingUpdates[playFabId].statistics;
+        const auto existing = statistics.find(statisticName);
+        if (existing == statistics.end())
+        {
+            statistics.emplace(statisticName, value);
+            ++pendingUpdateCount;
+        }
+        else if (GetStatisticMode(statisticName) == StatisticMergeMode::Sum)
+        {
+            existing->second += value;
+        }
+        else
+        {
+            existing->second = value;
+        }
+
+        NotifyIfFull();
+    }
+
+    void PlayFabWriteBehind::SetUserData(const std::string& playFabId, const std::string& key, const std::string& value)
+    {
+        std::unique_lock<std::mutex> lock(bufferMutex);
+
+        auto& player = pendingUpdates[playFabId];
+        const bool replacedRemoval = player.userDataKeysToRemove.erase(key) != 0;
+        const auto existing = player.userData.find(key);
+        if (existing == player.userData.end())
+        {
+            player.userData.emplace(key, value);
+            if (!replacedRemoval)
+                ++pendingUpdateCount;
+        }
+        else
+        {
+            existing->second = value;
+        }
+
+        NotifyIfFull();
+    }
+
+    void PlayFabWriteBehind::RemoveUserData(const std::string& playFabId, const std::string& key)
+    {
+        std::unique_lock<std::mutex> lock(bufferMutex);
+
+        auto& player = pendingUpdates[playFabId];
+        const bool replacedWrite = player.userData.erase(key) != 0;
+        if (player.userDataKeysToRemove.insert(key).second && !replacedWrite)
+            ++pendingUpdateCount;
+
+        NotifyIfFull();
+    }
+
+    void PlayFabWriteBehind::Flush()
+    {
+        SendPending();
+    }
+
+    bool PlayFabWriteBehind::FlushAndWait(unsigned int timeoutMs)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        unsigned int failedRounds = 0;
+
+        // Failed requests are put back in the buffer, so keep sending in rounds until everything has landed
+        while (true)
+        {
+            size_t failuresBeforeRound;
+            { // LOCK bufferMutex
+                std::unique_lock<std::mutex> lock(bufferMutex);
+                failuresBeforeRound = transientFailureCount;
+            } // UNLOCK bufferMutex
+
+            SendPending();
+
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            while (requestsInFlight != 0)
+            {
+                if (std::chrono::steady_clock::now() >= deadline)
+                    return false;
+
+                if (PlayFabSettings::threadedCallbacks)
+                {
+                    requestsCompleteCondition.wait_until(lock, deadline, []() { return requestsInFlight == 0; });
+                }
+                else
+                {
+                    // Nobody else is guaranteed to be pumping results (e.g. inside the GSDK shutdown callback), so do it here
+                    lock.unlock();
+                    if (IPlayFabHttp::Get().Update() == 0)
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    lock.lock();
+                }
+            }
+
+            if (pendingUpdates.empty())
+                return true;
+            if (std::chrono::steady_clock::now() >= deadline)
+                return false;
+
+            // PlayFab is throttling or failing, so give it time before the next round rather than resending straight away
+            if (transientFailureCount != failuresBeforeRound)
+            {
+                const auto retryTime = (std::min)(deadline, std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(writeBehindSettings.retryDelayMs) << (std::min)(failedRounds, c_maxRetryDoublings)));
+                ++failedRounds;
+                lock.unlock();
+                std::this_thread::sleep_until(retryTime);
+            }
+        }
+    }
+
+    std::function<void()> PlayFabWriteBehind::FlushBeforeShutdown(std::function<void()> shutdownCallback, unsigned int timeoutMs)
+    {
+        return [shutdownCallback, timeoutMs]()
+        {
+            FlushAndWait(timeoutMs);
+            if (shutdownCallback != nullptr)
+                shutdownCallback();
+        };
+    }
+
+    void PlayFabWriteBehind::FlushThread()
+    {
+        std::unique_lock<std::mutex> lock(bufferMutex);
+
+        while (flushThreadRunning)
+        {
+            flushCondition.wait_for(lock, std::chrono::milliseconds(writeBehindSettings.flushIntervalMs), []() { return flushRequested || !flushThreadRunning; });
+            flushRequested = false;
+
+            lock.unlock();
+            SendPending();
+            lock.lock();
+        }
+    }
+
+    void PlayFabWriteBehind::SendPending()
+    {
+        std::unordered_map<std::string, PendingPlayerUpdates> toSend;
+
+        { // LOCK bufferMutex
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            toSend.swap(pendingUpdates);
+            pendingUpdateCount = 0;
+        } // UNLOCK bufferMutex
+
+        for (const auto& player : toSend)
+            SendPlayerUpdates(player.first, player.second);
+    }
+
+    void PlayFabWriteBehind::SendPlayerUpdates(const std::string& playFabId, const PendingPlayerUpdates& updates)
+    {
+        std::vector<std::pair<UpdateUserDataRequest, PendingPlayerUpdates>> userDataBatches;
+        auto nextUserDataBatch = [&]() -> std::pair<UpdateUserDataRequest, PendingPlayerUpdates>&
+        {
+            if (userDataBatches.empty() || userDataBatches.back().first.Data.size() + userDataBatches.back().first.KeysToRemove.size() >= c_maxUserDataKeysPerRequest)
+            {
+                userDataBatches.emplace_back();
+                userDataBatches.back().first.PlayFabId = playFabId;
+            }
+            return userDataBatches.back();
+        };
+
+        for (const auto& data : updates.userData)
+        {
+            auto& batch = nextUserDataBatch();
+            batch.first.Data[data.first] = data.second;
+            batch.second.userData[data.first] = data.second;
+        }
+        for (const auto& key : updates.userDataKeysToRemove)
+        {
+            auto& batch = nextUserDataBatch();
+            batch.first.KeysToRemove.push_back(key);
+            batch.second.userDataKeysToRemove.insert(key);
+        }
+
+        { // LOCK bufferMutex
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            requestsInFlight += userDataBatches.size() + (updates.statistics.empty() ? 0 : 1);
+        } // UNLOCK bufferMutex
+
+        if (!updates.statistics.empty())
+        {
+            UpdatePlayerStatisticsRequest request;
+            request.PlayFabId = playFabId;
+            for (const auto& statistic : updates.statistics)
+            {
+                StatisticUpdate update;
+                update.StatisticName = statistic.first;
+                update.Value = statistic.second;
+                request.Statistics.push_back(update);
+            }
+
+            PendingPlayerUpdates sent;
+            sent.statistics = updates.statistics;
+            PlayFabServerAPI::UpdatePlayerStatistics(request,
+                [](const UpdatePlayerStatisticsResult&, void*) { OnRequestComplete(); },
+                [playFabId, sent](const PlayFabError& error, void*) { OnRequestFailed(error, playFabId, sent); });
+        }
+
+        for (auto& batch : userDataBatches)
+        {
+            const PendingPlayerUpdates& sent = batch.second;
+            PlayFabServerAPI::UpdateUserData(batch.first,
+                [](const UpdateUserDataResult&, void*) { OnRequestComplete(); },
+                [playFabId, sent](const PlayFabError& error, void*) { OnRequestFailed(error, playFabId, sent); });
+        }
+    }
+
+    void PlayFabWriteBehind::OnRequestComplete()
+    {
+        { // LOCK bufferMutex
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            --requestsInFlight;
+        } // UNLOCK bufferMutex
+
+        requestsCompleteCondition.notify_all();
+    }
+
+    void PlayFabWriteBehind::OnRequestFailed(const PlayFabError& error, const std::string& playFabId, const PendingPlayerUpdates& failedUpdates)
+    {
+        // Rejected requests would fail again, transient failures are retried with the next flush
+        const bool rejected = !error.IsTransient();
+        ErrorCallback errorCallback;
+
+        { // LOCK bufferMutex
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            errorCallback = writeBehindSettings.errorCallback;
+
+            if (!rejected)
+            {
+                ++transientFailureCount;
+
+                // Merge the failed updates back in underneath anything newer that was buffered in the meantime
+                auto& player = pendingUpdates[playFabId];
+                for (const auto& statistic : failedUpdates.statistics)
+                {
+                    const auto existing = player.statistics.find(statistic.first);
+                    if (existing == player.statistics.end())
+                    {
+                        player.statistics.emplace(statistic.first, statistic.second);
+                        ++pendingUpdateCount;
+                    }
+                    else if (GetStatisticMode(statistic.first) == StatisticMergeMode::Sum)
+                    {
+                        existing->second += statistic.second;
+                    }
+                }
+                for (const auto& data : failedUpdates.userData)
+                {
+                    if (player.userDataKeysToRemove.count(data.first) == 0 && player.userData.emplace(data.first, data.second).second)
+                        ++pendingUpdateCount;
+                }
+                for (const auto& key : failedUpdates.userDataKeysToRemove)
+                {
+                    if (player.userData.count(key) == 0 && player.userDataKeysToRemove.insert(key).second)
+                        ++pendingUpdateCount;
+                }
+            }
+        } // UNLOCK bufferMutex
+
+        if (rejected && errorCallback != nullptr)
+            errorCallback(error, nullptr);
+
+        OnRequestComplete();
+    }
+
+    // Requires bufferMutex to be held
+    StatisticMergeMode PlayFabWriteBehind::GetStatisticMode(const std::string& statisticName)
+    {
+        const auto mode = writeBehindSettings.statisticModes.find(statisticName);
+        return mode == writeBehindSettings.statisticModes.end() ? writeBehindSettings.defaultStatisticMode : mode->second;
+    }
+
+    // Requires bufferMutex to be held
+    void PlayFabWriteBehind::NotifyIfFull()
+    {
+        if (pendingUpdateCount >= writeBehindSettings.maxPendingUpdates)
+        {
+            flushRequested = true;
+            flushCondition.notify_one();
+        }
+    }
+}
+
+#endif
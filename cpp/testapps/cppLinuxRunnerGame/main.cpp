@@ -7,7 +7,10 @@
 #include <stdio.h>
 #include <sstream>
 #include <sys/socket.h>
+#include <sys/epoll.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <errno.h>
 #include <string.h>
 #include <unistd.h>
 #include <unordered_map>
@@ -16,12 +19,29 @@
 #include <fstream>
 #include <algorithm>
 #include <future>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "gsdk.h"
 
 #define PORT 3600
-
-static int requestCount = 0;
+#define GAME_PORT_NAME "gameport" // The Build's port to listen on. Without one (e.g. outside PlayFab) we listen on PORT
+#define MAX_WORKER_THREADS 4
+#define MAX_REQUEST_HEADER_SIZE 8192
+#define MAX_REQUEST_BODY_SIZE 65536
+#define MAX_BUFFERED_INPUT (MAX_REQUEST_HEADER_SIZE + MAX_REQUEST_BODY_SIZE) // Enough for any one request we accept
+#define OUTPUT_HIGH_WATER_MARK 65536 // Pipelined requests wait to be answered while this much output is unsent
+#define MAX_EPOLL_EVENTS 64
+
+// Only in the headers of newer glibc releases, and ignored (see runWorker) by kernels before 4.5
+#ifndef EPOLLEXCLUSIVE
+#define EPOLLEXCLUSIVE (1u << 28)
+#endif
+
+static std::atomic<int> requestCount(0);
 static time_t nextMaintenance;
 static std::string assetFileTextPath = "/data/Assets/testassetfile.txt";
 static std::string assetFileTarPath = "/data/AssetsTar/testassetfile.txt";
@@ -30,21 +50,50 @@ static std::string assetFileText;
 static std::string assetFileTar;
 static std::string assetFileTarGz;
 static std::string testCertificate;
-static bool isActivated = false;
-static bool isShutdown = false;
-static bool delayShutdown = false;
+static std::atomic<bool> isActivated(false);
+static std::atomic<bool> isShutdown(false);
+static std::atomic<bool> delayShutdown(false);
 static bool isMaintenancedScheduled = false;
+static std::mutex playersMutex;
 static std::vector<Microsoft::Azure::Gaming::ConnectedPlayer> players;
 
 static std::future<void> processRequestsThread;
 static struct sockaddr_in address;
 static int server_fd;
 
+// The reply body only changes with the GSDK's config or with our own state, so it is built once per version of them
+// and shared by every request until then. stateVersion counts the changes to our state: activation, shutdown and maintenance.
+struct CachedResponse
+{
+    unsigned long long configVersion;
+    unsigned int stateVersion;
+    bool isShutdown;
+    std::string headers; // Up to the Date header's value, which changes every second
+    std::string body;
+};
+
+static std::atomic<unsigned int> stateVersion(0);
+static std::shared_ptr<const CachedResponse> cachedResponse; // Only accessed through std::atomic_load/atomic_store
+
+// A keep-alive connection, owned by the worker whose epoll instance it was accepted on
+struct Connection
+{
+    int fd;
+    std::string input;
+    std::string output;
+    size_t outputSent;
+    bool closeAfterWrite; // The client asked to close after this reply, so later requests go unanswered
+    bool peerFinished; // The client is done sending, but may still be waiting on replies to what it sent
+    bool sendingShutdown; // The output tells the client we were shut down
+    bool waitingToWrite; // Registered for EPOLLOUT rather than EPOLLIN, as the socket didn't take all the output
+};
+
 
 void inShutdown()
 {
     printf("GSDK is shutting me down!!!\n");
     isShutdown = true;
+    stateVersion++;
 
     if (!delayShutdown)
     {
@@ -61,6 +110,7 @@ void maintenanceScheduled(tm t)
 {
     nextMaintenance = timegm(&t);
     isMaintenancedScheduled = true;
+    stateVersion++;
 }
 
 std::string escape(std::string const &s)
@@ -77,111 +127,415 @@ std::string escape(std::string const &s)
     return escaped;
 }
 
-void processRequests()
+std::shared_ptr<const CachedResponse> buildResponse(unsigned long long configVersion, unsigned int version)
 {
-    while (true)
+    std::unordered_map<std::string, std::string> config = Microsoft::Azure::Gaming::GSDK::getConfigSettings();
+
+    // First, check if we need to delay shutdown for testing
+    auto it = config.find(Microsoft::Azure::Gaming::GSDK::SESSION_COOKIE_KEY);
+
+    if (it != config.end() && strcmp(it->second.c_str(), "delayshutdown") == 0)
     {
-        int new_socket;
-        ssize_t valread;
-        int addrlen = sizeof(address);
-        char buffer[1024] = { 0 };
+        delayShutdown = true;
+    }
 
-        if ((new_socket = accept(server_fd, (struct sockaddr *)&address,
-            (socklen_t*)&addrlen))<0)
+    if (isActivated)
+    {
+        std::string playersJoinedAsString = "";
+        for (auto player : Microsoft::Azure::Gaming::GSDK::getInitialPlayers())
         {
-            perror("accept");
-            exit(EXIT_FAILURE);
+            playersJoinedAsString += (playersJoinedAsString.empty() ? "" : ",") + player;
+        }
+
+        config["initialPlayers"] = playersJoinedAsString;
+    }
+
+    config["isActivated"] = isActivated? "true" : "false";
+    config["isShutdown"] = isShutdown? "true" : "false";
+    config["assetFileText"] = assetFileText;
+    config["assetFileTar"] = assetFileTar;
+    config["assetFileTarGz"] = assetFileTarGz;
+    config["testCertificate"] = testCertificate;
+
+    const Microsoft::Azure::Gaming::GamePort *gamePort = Microsoft::Azure::Gaming::GSDK::getGamePort(GAME_PORT_NAME);
+    if (gamePort != nullptr)
+    {
+        config["Public" GAME_PORT_NAME] = std::to_string(gamePort->m_clientConnectionPort);
+    }
+
+    if (isMaintenancedScheduled)
+    {
+        std::string timeStr(asctime(localtime(&nextMaintenance)));
+        timeStr.erase(std::remove(timeStr.begin(), timeStr.end(), '\n'), timeStr.end());
+        config["nextMaintenance"] = timeStr;
+    }
+
+    std::shared_ptr<CachedResponse> response = std::make_shared<CachedResponse>();
+    response->configVersion = configVersion;
+    response->stateVersion = version;
+    response->isShutdown = isShutdown;
+
+    // Format the response
+    bool first = true;
+    std::string &content = response->body;
+    content.reserve(1024);
+    content += "{\r\n";
+    for (auto configVal : config)
+    {
+        if (!first) {
+            content += ",\r\n";
+        }
+
+        content += "\"";
+        content += configVal.first;
+        content += "\"";
+        content += ": ";
+        content += "\"";
+        content += escape(configVal.second);
+        content += "\"";
+
+        first = false;
+    }
+    content += "\r\n}";
+
+    response->headers += "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: ";
+    response->headers += std::to_string(content.size());
+    response->headers += "\r\nDate: ";
+    return response;
+}
+
+std::shared_ptr<const CachedResponse> getResponse()
+{
+    // Read the versions first, so a change made while building is picked up by the next request rather than lost
+    unsigned long long configVersion = Microsoft::Azure::Gaming::GSDK::getConfigVersion();
+    unsigned int version = stateVersion;
+
+    std::shared_ptr<const CachedResponse> response = std::atomic_load(&cachedResponse);
+    if (response == nullptr || response->configVersion != configVersion || response->stateVersion != version)
+    {
+        // Workers that miss at the same time each build it, which is cheaper than making the others wait
+        response = buildResponse(configVersion, version);
+        std::atomic_store(&cachedResponse, response);
+    }
+    return response;
+}
+
+// The Date header, formatted once a second by each worker
+const std::string &getDateHeader()
+{
+    thread_local time_t formattedAt = 0;
+    thread_local std::string formatted;
+
+    time_t now = time(0);
+    if (now != formattedAt)
+    {
+        char dateBuf[100];
+        struct tm tm;
+        gmtime_r(&now, &tm);
+        strftime(dateBuf, sizeof dateBuf, "%a, %d %b %Y %H:%M:%S GMT", &tm);
+        formatted = dateBuf;
+        formattedAt = now;
+    }
+    return formatted;
+}
+
+// Expects the headers in lower case
+bool hasHeaderToken(const std::string &lowerHeaders, const char *header, const char *token)
+{
+    size_t found = lowerHeaders.find(std::string("\r\n") + header + ":");
+    if (found == std::string::npos)
+    {
+        return false;
+    }
+    size_t valueEnd = lowerHeaders.find("\r\n", found + 2);
+    return lowerHeaders.substr(found, valueEnd - found).find(token) != std::string::npos;
+}
+
+// Answers the complete requests in the connection's input, which may hold several when the client pipelines them,
+// until the output reaches OUTPUT_HIGH_WATER_MARK. Returns false when the connection sent something we can't answer, and should be closed.
+bool processInput(Connection &connection)
+{
+    while (!connection.closeAfterWrite && connection.output.size() < OUTPUT_HIGH_WATER_MARK)
+    {
+        size_t headersEnd = connection.input.find("\r\n\r\n");
+        if (headersEnd == std::string::npos)
+        {
+            return connection.input.size() <= MAX_REQUEST_HEADER_SIZE;
+        }
+
+        std::string lowerHeaders = connection.input.substr(0, headersEnd + 2);
+        std::transform(lowerHeaders.begin(), lowerHeaders.end(), lowerHeaders.begin(), ::tolower);
+        bool isHttp10 = lowerHeaders.substr(0, lowerHeaders.find("\r\n")).find("http/1.0") != std::string::npos;
+
+        // Bodies are not used, but have to be skipped to find the next request
+        size_t contentLength = 0;
+        size_t contentLengthHeader = lowerHeaders.find("\r\ncontent-length:");
+        if (contentLengthHeader != std::string::npos)
+        {
+            contentLength = strtoul(lowerHeaders.c_str() + contentLengthHeader + 17, nullptr, 10);
+        }
+        if (contentLength > MAX_REQUEST_BODY_SIZE || hasHeaderToken(lowerHeaders, "transfer-encoding", "chunked"))
+        {
+            return false;
         }
-        valread = read(new_socket, buffer, 1024);
-        printf("HTTP:Received %.*s\n", valread, buffer);
 
-        // For each request, "add" a connected player
-        players.push_back(Microsoft::Azure::Gaming::ConnectedPlayer("gamer" + std::to_string(requestCount)));
+        size_t requestSize = headersEnd + 4 + contentLength;
+        if (connection.input.size() < requestSize)
+        {
+            return true;
+        }
+        connection.input.erase(0, requestSize);
+
+        // Health alternates with every request
         requestCount++;
-        Microsoft::Azure::Gaming::GSDK::updateConnectedPlayers(players);
 
-        std::unordered_map<std::string, std::string> config = Microsoft::Azure::Gaming::GSDK::getConfigSettings();
+        connection.closeAfterWrite = isHttp10 ? !hasHeaderToken(lowerHeaders, "connection", "keep-alive") : hasHeaderToken(lowerHeaders, "connection", "close");
 
-        // First, check if we need to delay shutdown for testing
-        auto it = config.find(Microsoft::Azure::Gaming::GSDK::SESSION_COOKIE_KEY);
+        std::shared_ptr<const CachedResponse> response = getResponse();
+        connection.sendingShutdown = connection.sendingShutdown || response->isShutdown;
+        connection.output += response->headers;
+        connection.output += getDateHeader();
+        connection.output += connection.closeAfterWrite ? "\r\nConnection: close\r\n\r\n" : "\r\n\r\n";
+        connection.output += response->body;
+    }
+    return true;
+}
 
-        if (it != config.end() && strcmp(it->second.c_str(), "delayshutdown") == 0)
+// Sends as much of the connection's output as the socket takes. Returns false if the connection failed.
+bool flushOutput(Connection &connection)
+{
+    while (connection.outputSent < connection.output.size())
+    {
+        ssize_t sent = send(connection.fd, connection.output.data() + connection.outputSent, connection.output.size() - connection.outputSent, MSG_NOSIGNAL);
+        if (sent < 0)
         {
-            delayShutdown = true;
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
         }
+        connection.outputSent += sent;
+    }
+
+    connection.output.clear();
+    connection.outputSent = 0;
 
-        if (isActivated)
+    // If we were shutdown, that was the last reply we would send
+    if (connection.sendingShutdown)
+    {
+        std::exit(0);
+    }
+    return true;
+}
+
+void acceptConnections(int epoll_fd, std::unordered_map<int, std::unique_ptr<Connection>> &connections)
+{
+    while (true)
+    {
+        int new_socket = accept4(server_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (new_socket < 0)
         {
-            std::string playersJoinedAsString = "";
-            for (auto player : Microsoft::Azure::Gaming::GSDK::getInitialPlayers())
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNABORTED)
             {
-                playersJoinedAsString += (playersJoinedAsString.empty() ? "" : ",") + player;
+                perror("accept");
             }
+            return;
+        }
 
-            config["initialPlayers"] = playersJoinedAsString;
+        int opt = 1;
+        setsockopt(new_socket, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+
+        std::unique_ptr<Connection> connection(new Connection());
+        connection->fd = new_socket;
+        connection->outputSent = 0;
+        connection->closeAfterWrite = false;
+        connection->peerFinished = false;
+        connection->sendingShutdown = false;
+        connection->waitingToWrite = false;
+
+        struct epoll_event event = {};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.fd = new_socket;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, new_socket, &event) < 0)
+        {
+            perror("epoll_ctl");
+            close(new_socket);
+            continue;
         }
+        connections[new_socket] = std::move(connection);
+
+        // For each connection, "add" a connected player. Connections are kept alive, so this no longer happens per request
+        std::lock_guard<std::mutex> lock(playersMutex);
+        players.push_back(Microsoft::Azure::Gaming::ConnectedPlayer("gamer" + std::to_string(players.size())));
+        Microsoft::Azure::Gaming::GSDK::updateConnectedPlayers(players);
+    }
+}
 
-        config["isActivated"] = isActivated? "true" : "false";
-        config["isShutdown"] = isShutdown? "true" : "false";
-        config["assetFileText"] = assetFileText;
-        config["assetFileTar"] = assetFileTar;
-        config["assetFileTarGz"] = assetFileTarGz;
-        config["testCertificate"] = testCertificate;
+void closeConnection(int epoll_fd, std::unordered_map<int, std::unique_ptr<Connection>> &connections, int fd)
+{
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(fd);
+}
 
-        if (isMaintenancedScheduled)
+// Sends the pending output, then answers and sends the requests already read, until the socket stops taking the output.
+// Returns false if the connection failed.
+bool answerRequests(Connection &connection)
+{
+    while (true)
+    {
+        if (!flushOutput(connection))
+        {
+            return false;
+        }
+        if (!connection.output.empty())
         {
-            std::string timeStr(asctime(localtime(&nextMaintenance)));
-            timeStr.erase(std::remove(timeStr.begin(), timeStr.end(), '\n'), timeStr.end());
-            config["nextMaintenance"] = timeStr;
+            return true;
         }
 
-        // Format the response
-        bool first = true;
-        std::string content;
-        content.reserve(1024);
-        content += "{\r\n";
-        for (auto configVal : config)
+        if (!processInput(connection))
+        {
+            return false;
+        }
+        if (connection.output.empty())
+        {
+            // Whatever input is left is an incomplete request
+            return true;
+        }
+    }
+}
+
+// Reads and answers whatever the connection has ready. Returns false once it should be closed.
+bool serviceConnection(int epoll_fd, Connection &connection, uint32_t events)
+{
+    if (events & EPOLLERR)
+    {
+        return false;
+    }
+
+    // Requests are only read while earlier replies are sent, and only as much as one request can take,
+    // so a client that pipelines requests without reading the replies can't make us buffer without limit.
+    // Level-triggered EPOLLIN picks up the rest once we get to it.
+    if ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) && connection.output.empty())
+    {
+        char buffer[16384];
+        while (connection.input.size() < MAX_BUFFERED_INPUT)
         {
-            if (!first) {
-                content += ",\r\n";
+            ssize_t valread = read(connection.fd, buffer, std::min(sizeof(buffer), MAX_BUFFERED_INPUT - connection.input.size()));
+            if (valread > 0)
+            {
+                connection.input.append(buffer, valread);
             }
+            else if (valread == 0)
+            {
+                connection.peerFinished = true;
+                break;
+            }
+            else if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            else if (errno != EINTR)
+            {
+                return false;
+            }
+        }
+    }
 
-            content += "\"";
-            content += configVal.first;
-            content += "\"";
-            content += ": ";
-            content += "\"";
-            content += escape(configVal.second);
-            content += "\"";
+    if (!answerRequests(connection))
+    {
+        return false;
+    }
 
-            first = false;
+    if (connection.output.empty() && (connection.closeAfterWrite || connection.peerFinished))
+    {
+        return false;
+    }
+
+    // Keep-alive requests are usually answered in full straight away, so this rarely costs a system call
+    if (connection.waitingToWrite == connection.output.empty())
+    {
+        connection.waitingToWrite = !connection.output.empty();
+
+        struct epoll_event event = {};
+        event.events = connection.waitingToWrite ? EPOLLOUT : (EPOLLIN | EPOLLRDHUP);
+        event.data.fd = connection.fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, connection.fd, &event);
+    }
+    return true;
+}
+
+// Each worker accepts and serves its own connections on its own epoll instance, so workers share nothing but the
+// listening socket and the cached response.
+void runWorker()
+{
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0)
+    {
+        perror("epoll_create1");
+        exit(EXIT_FAILURE);
+    }
+
+    // EPOLLEXCLUSIVE wakes one worker per new connection rather than all of them
+    struct epoll_event listenEvent = {};
+    listenEvent.events = EPOLLIN | EPOLLEXCLUSIVE;
+    listenEvent.data.fd = server_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, server_fd, &listenEvent) < 0)
+    {
+        listenEvent.events = EPOLLIN;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, server_fd, &listenEvent) < 0)
+        {
+            perror("epoll_ctl");
+            exit(EXIT_FAILURE);
         }
-        content += "\r\n}";
-
-        char dateBuf[1000];
-        time_t now = time(0);
-        struct tm tm = *gmtime(&now);
-        strftime(dateBuf, sizeof dateBuf, "%a, %d %b %Y %H:%M:%S %Z", &tm);
-
-        std::string reply;
-        reply.reserve(2048);
-        reply += "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: ";
-        reply += std::to_string(content.size());
-        reply += "\r\nDate: ";
-        reply += dateBuf;
-        reply += "\r\n\r\n";
-        reply += content;
-
-        send(new_socket, reply.c_str(), reply.size(), 0);
-
-        // If we were shutdown, that was the last reply we would send
-        if (isShutdown)
+    }
+
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+    while (true)
+    {
+        int ready = epoll_wait(epoll_fd, events, MAX_EPOLL_EVENTS, -1);
+        if (ready < 0)
         {
-            std::exit(0);
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("epoll_wait");
+            exit(EXIT_FAILURE);
+        }
+
+        for (int i = 0; i < ready; ++i)
+        {
+            int fd = events[i].data.fd;
+            if (fd == server_fd)
+            {
+                acceptConnections(epoll_fd, connections);
+                continue;
+            }
+
+            auto connection = connections.find(fd);
+            if (connection != connections.end() && !serviceConnection(epoll_fd, *connection->second, events[i].events))
+            {
+                closeConnection(epoll_fd, connections, fd);
+            }
         }
     }
 }
 
+void processRequests()
+{
+    unsigned int workerCount = std::min<unsigned int>(std::max(1u, std::thread::hardware_concurrency()), MAX_WORKER_THREADS);
+    printf("HTTP: serving with %u worker threads\n", workerCount);
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(&runWorker);
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
 std::string hex_encode(unsigned char* data, size_t len)
 {
     std::stringstream ss;
@@ -261,7 +615,7 @@ int main()
         int opt = 1;
 
         // Creating socket file descriptor
-        if ((server_fd = socket(AF_INET, SOCK_STREAM, 0)) == 0)
+        if ((server_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0)
         {
             perror("socket failed");
             exit(EXIT_FAILURE);
@@ -276,7 +630,8 @@ int main()
         }
         address.sin_family = AF_INET;
         address.sin_addr.s_addr = INADDR_ANY;
-        address.sin_port = htons(PORT);
+        const Microsoft::Azure::Gaming::GamePort *gamePort = Microsoft::Azure::Gaming::GSDK::getGamePort(GAME_PORT_NAME);
+        address.sin_port = htons(gamePort != nullptr ? gamePort->m_serverListeningPort : PORT);
 
         if (bind(server_fd, (struct sockaddr *)&address,
             sizeof(address))<0)
@@ -295,6 +650,7 @@ int main()
         if (Microsoft::Azure::Gaming::GSDK::readyForPlayers())
         {
             isActivated = true;
+            stateVersion++;
         }
 
         processRequestsThread.wait();
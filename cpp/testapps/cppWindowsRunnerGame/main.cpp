@@ -20,6 +20,7 @@
 #include "gsdk.h"
 
 #define PORT 3600
+#define GAME_PORT_NAME "gameport" // The Build's port to listen on. Without one (e.g. outside PlayFab) we listen on PORT
 
 static int requestCount = 0;
 static time_t nextMaintenance;
@@ -142,6 +143,12 @@ void processRequests()
         config["installedCertThumbprint"] = installedCertThumbprint;
         config["cmdArgs"] = cmdArgs;
 
+        const Microsoft::Azure::Gaming::GamePort *gamePort = Microsoft::Azure::Gaming::GSDK::getGamePort(GAME_PORT_NAME);
+        if (gamePort != nullptr)
+        {
+            config["Public" GAME_PORT_NAME] = std::to_string(gamePort->m_clientConnectionPort);
+        }
+
         if (isMaintenancedScheduled)
         {
             char buffer[10];
@@ -352,7 +359,8 @@ int main(int argc, char* argv[])
         }
         address.sin_family = AF_INET;
         address.sin_addr.s_addr = INADDR_ANY;
-        address.sin_port = htons(PORT);
+        const Microsoft::Azure::Gaming::GamePort *gamePort = Microsoft::Azure::Gaming::GSDK::getGamePort(GAME_PORT_NAME);
+        address.sin_port = htons(gamePort != nullptr ? gamePort->m_serverListeningPort : PORT);
 
         if (bind(server_fd, (struct sockaddr *)&address, sizeof(address)) < 0)
         {
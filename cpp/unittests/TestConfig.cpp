@@ -30,6 +30,7 @@ Microsoft::Azure::Gaming::TestConfig::TestConfig(   const std::string & heartbea
     m_ipv4Address = ipv4Address;
     m_domainName = domainName;
     m_connectionInfo = connectionInfo;
+    m_shouldHeartbeat = false;
 }
 
 const std::string &Microsoft::Azure::Gaming::TestConfig::getHeartbeatEndpoint()
@@ -84,7 +85,12 @@ bool Microsoft::Azure::Gaming::TestConfig::shouldLog()
 
 bool Microsoft::Azure::Gaming::TestConfig::shouldHeartbeat()
 {
-    return false;
+    return m_shouldHeartbeat;
+}
+
+void Microsoft::Azure::Gaming::TestConfig::setShouldHeartbeat(bool shouldHeartbeat)
+{
+    m_shouldHeartbeat = shouldHeartbeat;
 }
 
 const std::unordered_map<std::string, std::string> &Microsoft::Azure::Gaming::TestConfig::getBuildMetadata()
@@ -43,6 +43,9 @@ namespace Microsoft
                 bool shouldLog();
                 bool shouldHeartbeat();
 
+                // Off unless a test has an agent to heartbeat to
+                void setShouldHeartbeat(bool shouldHeartbeat);
+
             private:
                 std::string m_heartbeatEndpoint;
                 std::string m_serverId;
@@ -58,6 +61,7 @@ namespace Microsoft
                 std::string m_ipv4Address;
                 std::string m_domainName;
                 GameServerConnectionInfo m_connectionInfo;
+                bool m_shouldHeartbeat;
             };
         }
     }
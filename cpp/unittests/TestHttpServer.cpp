@@ -0,0 +1,317 @@
+#include "stdafx.h"
+#include "TestHttpServer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "Ws2_32.lib")
+typedef SOCKET SocketHandle;
+#define SHUT_RDWR SD_BOTH
+#define closeSocket closesocket
+#define MSG_NOSIGNAL 0
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+typedef int SocketHandle;
+#define INVALID_SOCKET (-1)
+#define closeSocket close
+#endif
+
+namespace
+{
+    SocketHandle toSocket(uintptr_t socket)
+    {
+        return static_cast<SocketHandle>(socket);
+    }
+
+    bool sendAll(uintptr_t socket, const char *data, size_t length)
+    {
+        while (length > 0)
+        {
+            int sent = static_cast<int>(send(toSocket(socket), data, static_cast<int>((std::min)(length, static_cast<size_t>(65536))), MSG_NOSIGNAL));
+            if (sent <= 0)
+            {
+                return false;
+            }
+            data += sent;
+            length -= sent;
+        }
+        return true;
+    }
+
+    std::string toLower(std::string value)
+    {
+        std::transform(value.begin(), value.end(), value.begin(), [](char c) { return static_cast<char>(tolower(static_cast<unsigned char>(c))); });
+        return value;
+    }
+
+    std::string trim(const std::string &value)
+    {
+        size_t first = value.find_first_not_of(" \t");
+        size_t last = value.find_last_not_of(" \t\r");
+        return first == std::string::npos ? std::string() : value.substr(first, last - first + 1);
+    }
+}
+
+std::string Microsoft::Azure::Gaming::TestHttpServer::Request::header(const std::string &name) const
+{
+    auto found = headers.find(toLower(name));
+    return found == headers.end() ? std::string() : found->second;
+}
+
+Microsoft::Azure::Gaming::TestHttpServer::TestHttpServer(Handler handler)
+    : m_handler(std::move(handler)), m_port(0), m_running(true)
+{
+#ifdef _WIN32
+    WSADATA wsaData;
+    WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+
+    SocketHandle listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0; // Any free port, so tests never collide with each other or a real agent
+    socklen_t addressLength = sizeof(address);
+
+    if (listenSocket == INVALID_SOCKET ||
+        bind(listenSocket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        listen(listenSocket, 16) != 0 ||
+        getsockname(listenSocket, reinterpret_cast<sockaddr *>(&address), &addressLength) != 0)
+    {
+        if (listenSocket != INVALID_SOCKET)
+        {
+            closeSocket(listenSocket);
+        }
+        throw std::runtime_error("The test HTTP server could not listen on the loopback interface.");
+    }
+
+    m_listenSocket = static_cast<uintptr_t>(listenSocket);
+    m_port = ntohs(address.sin_port);
+    m_acceptThread = std::thread(&TestHttpServer::acceptThreadFunc, this);
+}
+
+Microsoft::Azure::Gaming::TestHttpServer::~TestHttpServer()
+{
+    m_running = false;
+
+    // Shutting the sockets down wakes the threads blocked in accept and recv
+    shutdown(toSocket(m_listenSocket), SHUT_RDWR);
+    closeSocket(toSocket(m_listenSocket));
+    m_acceptThread.join();
+
+    std::vector<std::thread> connectionThreads;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (uintptr_t socket : m_connectionSockets)
+        {
+            shutdown(toSocket(socket), SHUT_RDWR);
+        }
+        connectionThreads.swap(m_connectionThreads);
+    }
+    for (std::thread &connectionThread : connectionThreads)
+    {
+        connectionThread.join();
+    }
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+unsigned short Microsoft::Azure::Gaming::TestHttpServer::getPort() const
+{
+    return m_port;
+}
+
+std::string Microsoft::Azure::Gaming::TestHttpServer::getEndpoint() const
+{
+    return "127.0.0.1:" + std::to_string(m_port);
+}
+
+std::vector<Microsoft::Azure::Gaming::TestHttpServer::Request> Microsoft::Azure::Gaming::TestHttpServer::getRequests()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_requests;
+}
+
+bool Microsoft::Azure::Gaming::TestHttpServer::waitForRequests(size_t count, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_requestsChanged.wait_for(lock, timeout, [this, count]() { return m_requests.size() >= count; });
+}
+
+bool Microsoft::Azure::Gaming::TestHttpServer::waitForHangUp(size_t requestIndex, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_requestsChanged.wait_for(lock, timeout, [this, requestIndex]()
+    {
+        return m_requests.size() > requestIndex && m_requests[requestIndex].hungUpAt != std::chrono::steady_clock::time_point();
+    });
+}
+
+void Microsoft::Azure::Gaming::TestHttpServer::acceptThreadFunc()
+{
+    while (m_running)
+    {
+        SocketHandle connectionSocket = accept(toSocket(m_listenSocket), nullptr, nullptr);
+        if (connectionSocket == INVALID_SOCKET)
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running)
+        {
+            closeSocket(connectionSocket);
+            break;
+        }
+        // A small send buffer keeps the server from running far ahead of a client that paces its reads, so client-side rate caps show in timings
+        int sendBufferBytes = 32 * 1024;
+        setsockopt(connectionSocket, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char *>(&sendBufferBytes), sizeof(sendBufferBytes));
+        m_connectionSockets.push_back(static_cast<uintptr_t>(connectionSocket));
+        m_connectionThreads.emplace_back(&TestHttpServer::connectionThreadFunc, this, static_cast<uintptr_t>(connectionSocket));
+    }
+}
+
+void Microsoft::Azure::Gaming::TestHttpServer::connectionThreadFunc(uintptr_t socket)
+{
+    std::string buffer;
+    Request request;
+    while (m_running && readRequest(socket, buffer, request))
+    {
+        size_t requestIndex;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests.push_back(request);
+            requestIndex = m_requests.size() - 1;
+        }
+        m_requestsChanged.notify_all();
+
+        Response response = m_handler(request);
+        if (!holdRequest(socket, response.holdMs))
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_requests[requestIndex].hungUpAt = std::chrono::steady_clock::now();
+            }
+            m_requestsChanged.notify_all();
+            break;
+        }
+
+        if (!sendResponse(socket, response) || response.dropAfterBytes < response.body.size() || toLower(request.header("Connection")) == "close")
+        {
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_connectionSockets.erase(std::find(m_connectionSockets.begin(), m_connectionSockets.end(), socket));
+    closeSocket(toSocket(socket));
+}
+
+bool Microsoft::Azure::Gaming::TestHttpServer::readRequest(uintptr_t socket, std::string &buffer, Request &request)
+{
+    char chunk[16384];
+    size_t headerEnd;
+    while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos)
+    {
+        int received = static_cast<int>(recv(toSocket(socket), chunk, sizeof(chunk), 0));
+        if (received <= 0)
+        {
+            return false;
+        }
+        buffer.append(chunk, received);
+    }
+
+    request = Request();
+    std::string head = buffer.substr(0, headerEnd + 2);
+    buffer.erase(0, headerEnd + 4);
+
+    size_t lineEnd = head.find("\r\n");
+    std::string requestLine = head.substr(0, lineEnd);
+    size_t methodEnd = requestLine.find(' ');
+    size_t pathEnd = requestLine.find(' ', methodEnd + 1);
+    request.method = requestLine.substr(0, methodEnd);
+    request.path = requestLine.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+
+    for (size_t lineStart = lineEnd + 2; lineStart < head.size(); lineStart = lineEnd + 2)
+    {
+        lineEnd = head.find("\r\n", lineStart);
+        std::string line = head.substr(lineStart, lineEnd - lineStart);
+        size_t colon = line.find(':');
+        if (colon != std::string::npos)
+        {
+            request.headers[toLower(line.substr(0, colon))] = trim(line.substr(colon + 1));
+        }
+    }
+
+    if (toLower(request.header("Expect")) == "100-continue")
+    {
+        static const char continueResponse[] = "HTTP/1.1 100 Continue\r\n\r\n";
+        if (!sendAll(socket, continueResponse, sizeof(continueResponse) - 1))
+        {
+            return false;
+        }
+    }
+
+    size_t contentLength = static_cast<size_t>(strtoull(request.header("Content-Length").c_str(), nullptr, 10));
+    while (buffer.size() < contentLength)
+    {
+        int received = static_cast<int>(recv(toSocket(socket), chunk, sizeof(chunk), 0));
+        if (received <= 0)
+        {
+            return false;
+        }
+        buffer.append(chunk, received);
+    }
+    request.body = buffer.substr(0, contentLength);
+    buffer.erase(0, contentLength);
+    request.receivedAt = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool Microsoft::Azure::Gaming::TestHttpServer::holdRequest(uintptr_t socket, unsigned int holdMs)
+{
+    auto holdUntil = std::chrono::steady_clock::now() + std::chrono::milliseconds(holdMs);
+    while (m_running && std::chrono::steady_clock::now() < holdUntil)
+    {
+        // A client that gives up closes its end, which shows up as a readable socket with nothing left to read
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(toSocket(socket), &readable);
+        timeval pollInterval = { 0, 10000 };
+        if (select(static_cast<int>(toSocket(socket)) + 1, &readable, nullptr, nullptr, &pollInterval) > 0)
+        {
+            char peek;
+            if (recv(toSocket(socket), &peek, 1, MSG_PEEK) <= 0)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // A pipelined request, which waits its turn
+        }
+    }
+    return m_running;
+}
+
+bool Microsoft::Azure::Gaming::TestHttpServer::sendResponse(uintptr_t socket, const Response &response)
+{
+    std::string head = "HTTP/1.1 " + std::to_string(response.status) + " Test\r\n";
+    head += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+    for (const auto &header : response.headers)
+    {
+        head += header.first + ": " + header.second + "\r\n";
+    }
+    head += "\r\n";
+
+    return sendAll(socket, head.data(), head.size()) &&
+        sendAll(socket, response.body.data(), (std::min)(response.body.size(), response.dropAfterBytes));
+}
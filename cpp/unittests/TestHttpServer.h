@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // A stand-in HTTP/1.1 server on 127.0.0.1 for tests that need a real agent or storage endpoint on the other end of curl.
+            // Each connection is served on its own thread with keep-alive, and every request is recorded before it is answered.
+            class TestHttpServer
+            {
+            public:
+                struct Request
+                {
+                    std::string method;
+                    std::string path;
+                    std::unordered_map<std::string, std::string> headers; // Names are lower case
+                    std::string body;
+                    std::chrono::steady_clock::time_point receivedAt;
+                    std::chrono::steady_clock::time_point hungUpAt; // When the client gave up on a held response, the epoch otherwise
+
+                    std::string header(const std::string &name) const;
+                };
+
+                struct Response
+                {
+                    int status = 200;
+                    std::vector<std::pair<std::string, std::string>> headers;
+                    std::string body;
+                    unsigned int holdMs = 0; // How long to sit on the request before answering, cut short if the client hangs up
+                    size_t dropAfterBytes = SIZE_MAX; // Sends this much of the body and then closes the connection
+                };
+
+                typedef std::function<Response(const Request &)> Handler;
+
+                explicit TestHttpServer(Handler handler);
+                ~TestHttpServer();
+
+                unsigned short getPort() const;
+                std::string getEndpoint() const; // "127.0.0.1:<port>"
+
+                std::vector<Request> getRequests();
+                bool waitForRequests(size_t count, std::chrono::milliseconds timeout);
+                bool waitForHangUp(size_t requestIndex, std::chrono::milliseconds timeout);
+
+            private:
+                TestHttpServer(const TestHttpServer &) = delete;
+                TestHttpServer &operator=(const TestHttpServer &) = delete;
+
+                void acceptThreadFunc();
+                void connectionThreadFunc(uintptr_t socket);
+                bool readRequest(uintptr_t socket, std::string &buffer, Request &request);
+                bool holdRequest(uintptr_t socket, unsigned int holdMs);
+                bool sendResponse(uintptr_t socket, const Response &response);
+
+                Handler m_handler;
+                uintptr_t m_listenSocket;
+                unsigned short m_port;
+                std::atomic<bool> m_running;
+                std::thread m_acceptThread;
+
+                std::mutex m_mutex;
+                std::condition_variable m_requestsChanged;
+                std::vector<Request> m_requests;
+                std::vector<uintptr_t> m_connectionSockets;
+                std::vector<std::thread> m_connectionThreads;
+            };
+        }
+    }
+}
@@ -5,6 +5,7 @@
 #include "..\cppsdk\gsdkInternal.h"
 
 #include "TestConfig.h"
+#include "TestHttpServer.h"
 
 #include <chrono>
 #include <thread>
@@ -25,6 +26,8 @@ namespace Microsoft
                     // Cleaning up the test instance between tests
                     GSDKInternal::testConfiguration.reset();
                     GSDKInternal::m_instance.reset();
+                    setEnvironmentVariable("GSDK_HEARTBEAT_ENCODING", "");
+                    setEnvironmentVariable("GSDK_HEARTBEAT_LONG_POLL_SECONDS", "");
                 }
 
                 TEST_METHOD(ConfigAllSetInitializesFine)
@@ -401,6 +404,543 @@ namespace Microsoft
                     Assert::IsTrue(shutdownCalled, L"Verify our shutdown callback was called.");
                 }
 
+                TEST_METHOD(AllocationCallbackReceivesInitialPlayers)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+
+                    std::vector<std::string> allocatedPlayers;
+                    bool activeWhenCalled = false;
+                    GSDK::registerAllocationCallback([&allocatedPlayers, &activeWhenCalled](const std::vector<std::string> &players) -> void
+                    {
+                        allocatedPlayers = players;
+                        activeWhenCalled = GSDKInternal::m_instance->m_heartbeatRequest.m_currentGameState == GameState::Active;
+                    });
+
+                    std::string responseJson =
+                        R"({
+                                "operation":"Active",
+                                "sessionConfig":
+                                {
+                                    "sessionId":"eca7e870-da2e-45f9-bb66-30d89064313a",
+                                    "initialPlayers": [ "player0", "player1" ]
+                                }
+                        }")";
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(responseJson);
+
+                    Assert::AreEqual((size_t)2, allocatedPlayers.size(), L"Verify the allocation callback received the initial players.");
+                    Assert::AreEqual(std::string("player1"), allocatedPlayers[1], L"Verify player1 was passed to the allocation callback.");
+                    Assert::IsTrue(activeWhenCalled, L"Verify the state was already Active when the callback ran.");
+
+                    // A repeated Active operation is not a new allocation
+                    allocatedPlayers.clear();
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(responseJson);
+                    Assert::IsTrue(allocatedPlayers.empty(), L"Verify the allocation callback only fires once per allocation.");
+                }
+
+                TEST_METHOD(AllocationStartsTraceJoinedByAllocationCallback)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+
+                    Assert::IsFalse(GSDK::getAllocationTraceContext().isValid(), L"Verify there is no allocation trace before allocation.");
+
+                    TraceContext contextInCallback;
+                    GSDK::registerAllocationCallback([&contextInCallback](const std::vector<std::string> &) -> void
+                    {
+                        contextInCallback = GSDKTrace::getCurrentContext();
+                    });
+
+                    std::string responseJson = R"({ "operation":"Active", "sessionConfig": { "sessionId":"eca7e870-da2e-45f9-bb66-30d89064313a" } })";
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(responseJson);
+
+                    TraceContext allocationContext = GSDK::getAllocationTraceContext();
+                    Assert::IsTrue(allocationContext.isValid(), L"Verify the allocation started a trace.");
+                    Assert::AreEqual(allocationContext.m_traceId, contextInCallback.m_traceId, L"Verify the allocation callback ran in the allocation's trace.");
+                    Assert::AreEqual(allocationContext.m_spanId, contextInCallback.m_spanId, L"Verify the allocation callback ran in the allocation's span.");
+                    Assert::IsFalse(GSDKTrace::getCurrentContext().isValid(), L"Verify the trace context is only current during the callback.");
+
+                    std::string traceparent = allocationContext.toTraceparent();
+                    Assert::AreEqual((size_t)55, traceparent.size(), L"Verify the traceparent has the W3C length.");
+                    Assert::AreEqual(std::string("00-") + allocationContext.m_traceId + "-" + allocationContext.m_spanId + "-01", traceparent, L"Verify the traceparent format.");
+
+                    TraceContext child = allocationContext.newChild();
+                    Assert::AreEqual(allocationContext.m_traceId, child.m_traceId, L"Verify a child span stays in the trace.");
+                    Assert::AreNotEqual(allocationContext.m_spanId, child.m_spanId, L"Verify a child span has its own id.");
+                }
+
+                TEST_METHOD(MessagePackRoundTripsHeartbeatRequest)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+
+                    std::vector<ConnectedPlayer> players;
+                    for (int i = 0; i < 20; ++i)
+                    {
+                        players.push_back(ConnectedPlayer("player" + std::to_string(i)));
+                    }
+                    GSDK::updateConnectedPlayers(players);
+
+                    Json::Value request = GSDKInternal::m_instance->buildHeartbeatRequest();
+                    request["Negative"] = -40000;
+                    request["Big"] = Json::UInt64(5000000000ULL);
+                    request["Real"] = 0.5;
+                    request["Missing"] = Json::Value::null;
+                    std::string encoded = cMessagePack::encode(request);
+
+                    Json::Value decoded;
+                    std::string errors;
+                    Assert::IsTrue(cMessagePack::decode(encoded, decoded, errors), L"Verify the encoded request decodes.");
+                    Assert::IsTrue(request == decoded, L"Verify the decoded request equals the original.");
+                    Assert::IsTrue(encoded.size() < request.toStyledString().size(), L"Verify MessagePack is smaller than JSON.");
+
+                    Assert::IsFalse(cMessagePack::decode(encoded.substr(0, encoded.size() - 1), decoded, errors), L"Verify truncated input is rejected.");
+                    Assert::IsFalse(cMessagePack::decode(encoded + '\xc0', decoded, errors), L"Verify trailing bytes are rejected.");
+                }
+
+                TEST_METHOD(HeartbeatEncodingFollowsAgentResponses)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+                    GSDKInternal::m_instance->m_heartbeatEncoding = HeartbeatEncoding::Negotiating;
+
+                    Json::Value response;
+                    response["operation"] = "Continue";
+                    response["nextHeartbeatIntervalMs"] = 5000;
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(cMessagePack::encode(response), "application/msgpack; charset=binary");
+
+                    Assert::IsTrue(GSDKInternal::m_instance->m_heartbeatEncoding == HeartbeatEncoding::MessagePack, L"Verify a MessagePack answer switches heartbeats to MessagePack.");
+                    Assert::AreEqual(5000, GSDKInternal::m_instance->m_nextHeartbeatIntervalMs, L"Verify the MessagePack response was processed.");
+
+                    GSDKInternal::m_instance->m_heartbeatEncoding = HeartbeatEncoding::Negotiating;
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(R"({ "operation":"Continue", "nextHeartbeatIntervalMs":6000 })", "application/json");
+
+                    Assert::IsTrue(GSDKInternal::m_instance->m_heartbeatEncoding == HeartbeatEncoding::Json, L"Verify a JSON answer stops the MessagePack offer.");
+                    Assert::AreEqual(6000, GSDKInternal::m_instance->m_nextHeartbeatIntervalMs, L"Verify the JSON response was processed.");
+                }
+
+                TEST_METHOD(LongPollOnlyAppliedWhenAgentAgrees)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+                    GSDKInternal* internal = GSDKInternal::m_instance.get();
+
+                    char otherHeader[] = "Content-Type: application/json\r\n";
+                    internal->m_longPollApplied = false;
+                    internal->curlReceiveHeader(otherHeader, 1, strlen(otherHeader), internal);
+                    Assert::IsFalse(internal->m_longPollApplied, L"Verify other headers don't turn on long polling.");
+
+                    char appliedHeader[] = "preference-applied: wait=30\r\n";
+                    internal->curlReceiveHeader(appliedHeader, 1, strlen(appliedHeader), internal);
+                    Assert::IsTrue(internal->m_longPollApplied, L"Verify the agent's Preference-Applied header is detected regardless of case.");
+                }
+
+                TEST_METHOD(LifecycleTimelineRecordsMilestonesOnceInOrder)
+                {
+                    for (auto &milestoneTime : GSDKInternal::m_milestoneTimes)
+                    {
+                        milestoneTime = 0;
+                    }
+
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(R"({ "operation":"Active" })");
+                    GSDK::readyForPlayers();
+                    GSDK::updateConnectedPlayers(std::vector<ConnectedPlayer>{ ConnectedPlayer("player0") });
+                    std::vector<LifecycleEvent> firstTimeline = GSDK::getLifecycleTimeline();
+                    GSDK::updateConnectedPlayers(std::vector<ConnectedPlayer>());
+
+                    std::vector<LifecycleEvent> timeline = GSDK::getLifecycleTimeline();
+                    std::vector<std::string> names;
+                    for (const LifecycleEvent &event : timeline)
+                    {
+                        names.push_back(event.m_name);
+                    }
+
+                    std::vector<std::string> expected = { "StartEntered", "StartReturned", "ActiveReceived", "ReadyForPlayersReturned", "FirstConnectedPlayersUpdate" };
+                    Assert::IsTrue(expected == names, L"Verify the milestones reached are listed in the order they were reached.");
+                    Assert::AreEqual(0.0, timeline[0].m_elapsedMs, L"Verify elapsed times count from the first milestone.");
+                    Assert::IsTrue(firstTimeline.back().m_time == timeline.back().m_time, L"Verify a repeated milestone keeps its first time.");
+                }
+
+                TEST_METHOD(EventSubscribersRunOnTheirExecutors)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+
+                    std::vector<std::string> stateChanges;
+                    GSDK::subscribe(GSDKEventType::StateChange, [&stateChanges](const GSDKEvent &event) -> void
+                    {
+                        stateChanges.push_back(event.m_previousState + "->" + event.m_newState);
+                    }, GSDKEventExecutor::Inline);
+
+                    // A slow worker subscriber, which must not hold up the heartbeat that raised the event
+                    std::promise<void> releaseWorker;
+                    std::shared_future<void> workerReleased = releaseWorker.get_future().share();
+                    std::promise<std::vector<std::string>> workerPlayers;
+                    GSDK::subscribe(GSDKEventType::Allocation, [workerReleased, &workerPlayers](const GSDKEvent &event) -> void
+                    {
+                        workerReleased.wait();
+                        workerPlayers.set_value(event.m_initialPlayers);
+                    });
+
+                    std::vector<std::string> changedKeys;
+                    GSDKSubscriptionId configSubscription = GSDK::subscribe(GSDKEventType::ConfigChange, [&changedKeys](const GSDKEvent &event) -> void
+                    {
+                        changedKeys = event.m_changedConfigKeys;
+                    }, GSDKEventExecutor::GameQueue);
+
+                    bool legacyCallbackCalled = false;
+                    GSDK::registerAllocationCallback([&legacyCallbackCalled](const std::vector<std::string> &) -> void
+                    {
+                        legacyCallbackCalled = true;
+                    });
+
+                    std::string responseJson = R"({ "operation":"Active", "sessionConfig": { "sessionId":"eca7e870-da2e-45f9-bb66-30d89064313a", "initialPlayers": [ "player0" ] } })";
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(responseJson);
+
+                    Assert::AreEqual((size_t)1, stateChanges.size(), L"Verify the inline subscriber ran before the heartbeat was processed.");
+                    Assert::AreEqual(std::string("Initializing->Active"), stateChanges[0], L"Verify the state change names both states.");
+                    Assert::IsTrue(legacyCallbackCalled, L"Verify the registered callback still runs alongside the subscribers.");
+                    Assert::IsTrue(changedKeys.empty(), L"Verify game queue subscribers wait for the game to dispatch.");
+
+                    Assert::AreEqual((size_t)1, GSDK::dispatchQueuedEvents(), L"Verify the config change was queued once.");
+                    Assert::IsTrue(std::vector<std::string>{ "sessionId" } == changedKeys, L"Verify only the string values that changed are reported.");
+
+                    releaseWorker.set_value();
+                    std::future<std::vector<std::string>> players = workerPlayers.get_future();
+                    Assert::IsTrue(players.wait_for(std::chrono::seconds(5)) == std::future_status::ready, L"Verify the worker subscriber ran once released.");
+                    Assert::IsTrue(std::vector<std::string>{ "player0" } == players.get(), L"Verify the allocation carries the initial players.");
+
+                    GSDK::unsubscribe(configSubscription);
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(R"({ "operation":"Continue", "sessionConfig": { "sessionId":"another" } })");
+                    Assert::AreEqual((size_t)0, GSDK::dispatchQueuedEvents(), L"Verify an unsubscribed handler gets no more events.");
+                }
+
+                TEST_METHOD(ConfigChangesReportOnlyChangedKeys)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+
+                    std::vector<GSDKEvent> configChanges;
+                    GSDK::subscribe(GSDKEventType::ConfigChange, [&configChanges](const GSDKEvent &event) -> void
+                    {
+                        configChanges.push_back(event);
+                    }, GSDKEventExecutor::Inline);
+
+                    unsigned long long initialVersion = GSDK::getConfigVersion();
+                    std::string responseJson = R"({ "operation":"Continue", "sessionConfig": { "sessionId":"session1", "metadata": { "map":"forest", "mode":"ctf" } } })";
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(responseJson);
+                    Assert::AreEqual((size_t)1, configChanges.size(), L"Verify the first session config is reported.");
+                    Assert::AreEqual((size_t)3, configChanges[0].m_changedConfigKeys.size(), L"Verify every new key is reported.");
+                    Assert::AreEqual(initialVersion + 1, GSDK::getConfigVersion(), L"Verify the version was bumped once.");
+                    Assert::AreEqual(GSDK::getConfigVersion(), configChanges[0].m_configVersion, L"Verify the event carries the new version.");
+
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(responseJson);
+                    Assert::AreEqual((size_t)1, configChanges.size(), L"Verify a repeated session config is skipped.");
+                    Assert::AreEqual(initialVersion + 1, GSDK::getConfigVersion(), L"Verify a repeated session config keeps the version.");
+
+                    // Reordered members and a changed non-string value change the hash, but no setting
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(R"({ "operation":"Continue", "sessionConfig": { "metadata": { "mode":"ctf", "map":"forest" }, "sessionId":"session1", "initialPlayers": [] } })");
+                    Assert::AreEqual((size_t)1, configChanges.size(), L"Verify a session config without changed values isn't reported.");
+
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(R"({ "operation":"Continue", "sessionConfig": { "sessionId":"session1", "metadata": { "map":"desert", "mode":"ctf" } } })");
+                    Assert::AreEqual((size_t)2, configChanges.size(), L"Verify a changed value is reported.");
+                    Assert::IsTrue(std::vector<std::string>{ "map" } == configChanges[1].m_changedConfigKeys, L"Verify only the changed key is reported.");
+                    Assert::AreEqual(initialVersion + 2, GSDK::getConfigVersion(), L"Verify the version was bumped again.");
+                    Assert::AreEqual(std::string("desert"), GSDK::getConfigSettings().at("map"), L"Verify the changed value was applied.");
+                }
+
+                TEST_METHOD(ConfigValuesMatchConfigSettings)
+                {
+                    std::unordered_map<std::string, std::string> metadata;
+                    metadata[GSDK::VM_ID_KEY] = "vm1";
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder", "certFolder", std::unordered_map<std::string, std::string>(), "titleId", "buildId", "region", metadata, std::unordered_map<std::string, std::string>());
+                    GSDK::start();
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(R"({ "operation":"Continue", "sessionConfig": { "sessionId":"session1", "sessionCookie":"cookie1" } })");
+
+                    const std::unordered_map<std::string, std::string> config = GSDK::getConfigSettings();
+                    for (int i = 0; i < static_cast<int>(ConfigKey::Count); ++i)
+                    {
+                        auto setting = config.find(ConfigKeyNames[i]);
+                        std::string expected = setting != config.end() ? setting->second : "";
+                        Assert::AreEqual(expected, GSDK::getConfigValue(static_cast<ConfigKey>(i)), L"Verify each well-known value matches its setting.");
+                    }
+                    Assert::AreEqual(std::string("vm1"), GSDK::getConfigValue(ConfigKey::VmId), L"Verify well-known keys from the metadata are found.");
+                    Assert::AreEqual(std::string("session1"), GSDK::getConfigValue(ConfigKey::SessionId), L"Verify well-known keys from the session config are found.");
+                }
+
+                TEST_METHOD(GamePortsFoundByName)
+                {
+                    std::vector<GamePort> gamePorts = { GamePort("game", 7777, 30000, "UDP"), GamePort("query", 7778, 30001) };
+                    std::unordered_map<std::string, std::string> ports;
+                    ports["game"] = "7777";
+                    ports["legacy"] = "8888";
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder", "certFolder", std::unordered_map<std::string, std::string>(), "titleId", "buildId", "region", std::unordered_map<std::string, std::string>(), ports, "127.0.0.1", "", GameServerConnectionInfo("127.0.0.1", gamePorts));
+                    GSDK::start();
+
+                    const GamePort *game = GSDK::getGamePort("game");
+                    Assert::IsNotNull(game, L"Verify a configured port is found.");
+                    Assert::AreEqual(7777, game->m_serverListeningPort, L"Verify the listening port.");
+                    Assert::AreEqual(30000, game->m_clientConnectionPort, L"Verify the connection port.");
+                    Assert::AreEqual(std::string("UDP"), game->m_protocol, L"Verify the protocol.");
+                    Assert::IsTrue(game == GSDK::getGamePort("game"), L"Verify every lookup returns the same port.");
+
+                    const GamePort *legacy = GSDK::getGamePort("legacy");
+                    Assert::IsNotNull(legacy, L"Verify a port only in the settings is found.");
+                    Assert::AreEqual(8888, legacy->m_serverListeningPort, L"Verify its listening port was converted.");
+                    Assert::AreEqual(0, legacy->m_clientConnectionPort, L"Verify its unknown connection port is 0.");
+
+                    Assert::AreEqual(std::string("query"), GSDK::getGamePort("query")->m_name, L"Verify the other ports are found too.");
+                    Assert::IsNull(GSDK::getGamePort("missing"), L"Verify an unknown name isn't found.");
+                }
+
+                TEST_METHOD(CallbackReplacedDuringInvocationStaysAlive)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+
+                    std::shared_ptr<std::string> captured = std::make_shared<std::string>("still alive");
+                    std::string seenAfterReplacing;
+                    GSDK::registerHealthCallback([captured, &seenAfterReplacing]() -> bool
+                    {
+                        GSDK::registerHealthCallback([]() -> bool { return false; });
+                        seenAfterReplacing = *captured;
+                        return true;
+                    });
+                    captured.reset();
+
+                    Json::Value firstRequest = GSDKInternal::m_instance->buildHeartbeatRequest();
+                    Assert::AreEqual(std::string("still alive"), seenAfterReplacing, L"Verify the callback's captures outlive its replacement while it runs.");
+                    Assert::AreEqual("Healthy", firstRequest["CurrentGameHealth"].asCString(), L"Verify the replaced callback's result was used.");
+
+                    Json::Value secondRequest = GSDKInternal::m_instance->buildHeartbeatRequest();
+                    Assert::AreEqual("Unhealthy", secondRequest["CurrentGameHealth"].asCString(), L"Verify the replacement is invoked from then on.");
+                }
+
+                TEST_METHOD(ResetEventsSignalAndTimeOut)
+                {
+                    ManualResetEvent gate;
+                    Assert::IsFalse(gate.Wait(10), L"Verify a closed gate times out.");
+                    gate.Signal();
+                    Assert::IsTrue(gate.Wait(10), L"Verify an open gate lets a wait through.");
+                    Assert::IsTrue(gate.Wait(10), L"Verify an open gate stays open.");
+                    gate.Reset();
+                    Assert::IsFalse(gate.Wait(10), L"Verify a reset gate is closed again.");
+
+                    AutoResetEvent event;
+                    event.Signal();
+                    event.Signal();
+                    Assert::IsTrue(event.Wait(10), L"Verify a signal lets a wait through.");
+                    Assert::IsFalse(event.Wait(10), L"Verify the event resets itself, and signals aren't counted.");
+
+                    std::thread signaler([&event, &gate]()
+                    {
+                        gate.Wait();
+                        event.Signal();
+                    });
+                    gate.Signal();
+                    Assert::IsTrue(event.Wait(5000), L"Verify a signal from another thread wakes a parked wait.");
+                    signaler.join();
+                }
+
+                TEST_METHOD(JsonConfigurationDecodedInOnePass)
+                {
+                    std::string json = R"({
+    "heartbeatEndpoint": "localhost:56001", // comments are allowed
+    "sessionHostId": "server\tId",
+    "logFolder": "logs\u00e9\ud83c\udfae",
+    "certificateFolder": null,
+    "addedInANewerAgent": { "nested": [1, 2.5e3, true, "x"] },
+    "buildMetadata": { "key": "value" },
+    "gameServerConnectionInfo": {
+        "publicIpV4Adress": "127.0.0.1",
+        "gamePortsConfiguration": [ { "name": "game", "serverListeningPort": 7777, "clientConnectionPort": 30000, "protocol": "UDP" } ]
+    }
+})";
+                    JsonFileConfiguration config(json.data(), json.size());
+
+                    Assert::AreEqual(std::string("localhost:56001"), config.getHeartbeatEndpoint(), L"Verify a string setting.");
+                    Assert::AreEqual(std::string("server\tId"), config.getServerId(), L"Verify escapes are decoded.");
+                    Assert::AreEqual(std::string("logs\xc3\xa9\xf0\x9f\x8e\xae"), config.getLogFolder(), L"Verify unicode escapes and surrogate pairs are decoded as UTF-8.");
+                    Assert::AreEqual(std::string(), config.getCertificateFolder(), L"Verify a null setting reads as empty.");
+                    Assert::AreEqual(std::string("value"), config.getBuildMetadata().at("key"), L"Verify a map setting.");
+                    Assert::AreEqual(std::string("127.0.0.1"), config.getGameServerConnectionInfo().m_publicIpV4Address, L"Verify the connection info.");
+                    Assert::AreEqual(1, static_cast<int>(config.getGameServerConnectionInfo().m_gamePortsConfiguration.size()), L"Verify the ports.");
+                    Assert::AreEqual(30000, config.getGameServerConnectionInfo().m_gamePortsConfiguration[0].m_clientConnectionPort, L"Verify a port number.");
+
+                    std::string mistyped = "{\n    \"heartbeatEndpoint\": \"localhost:56001\",\n    \"gameServerConnectionInfo\": { \"gamePortsConfiguration\": [ { \"serverListeningPort\": \"7777\" } ] }\n}";
+                    try
+                    {
+                        JsonFileConfiguration badConfig(mistyped.data(), mistyped.size());
+                        Assert::Fail(L"Did not throw an exception even though a port was a string.");
+                    }
+                    catch (const GSDKInitializationException &ex)
+                    {
+                        Assert::AreEqual(std::string("Failed to parse configuration at line 3, column 88: expected a port number between 0 and 65535 for serverListeningPort"), std::string(ex.what()), L"Verify the error points at the mistyped value.");
+                    }
+
+                    std::string truncated = "{ \"logFolder\": \"logs\"";
+                    try
+                    {
+                        JsonFileConfiguration badConfig(truncated.data(), truncated.size());
+                        Assert::Fail(L"Did not throw an exception even though the configuration was truncated.");
+                    }
+                    catch (const GSDKInitializationException &ex)
+                    {
+                        Assert::AreEqual(std::string("Failed to parse configuration at line 1, column 22: expected ',' or '}'"), std::string(ex.what()), L"Verify the error points at the end of the file.");
+                    }
+                }
+
+                TEST_METHOD(HeartbeatFallsBackToJsonWhenAgentRejectsMessagePack)
+                {
+                    // Answers the MessagePack offer in MessagePack, but can't read MessagePack requests
+                    TestHttpServer agent([](const TestHttpServer::Request &request)
+                    {
+                        TestHttpServer::Response response;
+                        if (request.header("Content-Type") == "application/msgpack")
+                        {
+                            response.status = 415;
+                            return response;
+                        }
+
+                        Json::Value body;
+                        body["operation"] = "Continue";
+                        body["nextHeartbeatIntervalMs"] = 1000;
+                        if (request.header("Accept").find("application/msgpack") != std::string::npos)
+                        {
+                            response.headers.push_back({ "Content-Type", "application/msgpack" });
+                            response.body = cMessagePack::encode(body);
+                        }
+                        else
+                        {
+                            response.headers.push_back({ "Content-Type", "application/json" });
+                            response.body = body.toStyledString();
+                        }
+                        return response;
+                    });
+                    startHeartbeating(agent);
+
+                    Assert::IsTrue(agent.waitForRequests(4, std::chrono::seconds(10)), L"Verify the GSDK kept heartbeating.");
+                    std::vector<TestHttpServer::Request> heartbeats = agent.getRequests();
+
+                    Assert::AreEqual(std::string("PATCH"), heartbeats[0].method, L"Verify heartbeats are PATCH requests.");
+                    Assert::AreEqual(std::string("/v1/sessionHosts/serverId"), heartbeats[0].path, L"Verify heartbeats go to the session host.");
+                    Assert::AreEqual(std::string("application/msgpack, application/json;q=0.9"), heartbeats[0].header("Accept"), L"Verify the first heartbeat offers MessagePack.");
+                    Assert::AreEqual(std::string("application/json; charset=utf-8"), heartbeats[0].header("Content-Type"), L"Verify the first heartbeat is sent as JSON.");
+
+                    Json::Value decoded;
+                    std::string errors;
+                    Assert::AreEqual(std::string("application/msgpack"), heartbeats[1].header("Content-Type"), L"Verify a MessagePack answer switches requests to MessagePack.");
+                    Assert::IsTrue(cMessagePack::decode(heartbeats[1].body, decoded, errors), L"Verify the MessagePack request decodes.");
+                    Assert::AreEqual(std::string("Initializing"), decoded["CurrentGameState"].asString(), L"Verify the MessagePack request carries the game state.");
+
+                    auto fallbackDelayMs = std::chrono::duration_cast<std::chrono::milliseconds>(heartbeats[2].receivedAt - heartbeats[1].receivedAt).count();
+                    Assert::IsTrue(fallbackDelayMs < 500, L"Verify the rejected heartbeat is sent again in JSON straight away.");
+                    for (size_t i = 2; i < heartbeats.size(); ++i)
+                    {
+                        Assert::AreEqual(std::string("application/json; charset=utf-8"), heartbeats[i].header("Content-Type"), L"Verify heartbeats stay in JSON after the rejection.");
+                        Assert::AreEqual(std::string("application/json"), heartbeats[i].header("Accept"), L"Verify MessagePack is no longer offered.");
+                        Assert::IsTrue(parseJson(heartbeats[i].body)["CurrentGameState"] == "Initializing", L"Verify the JSON request carries the game state.");
+                    }
+                }
+
+                TEST_METHOD(HeartbeatEncodingSetToJsonNeverOffersMessagePack)
+                {
+                    setEnvironmentVariable("GSDK_HEARTBEAT_ENCODING", "json");
+                    TestHttpServer agent([](const TestHttpServer::Request &)
+                    {
+                        TestHttpServer::Response response;
+                        response.headers.push_back({ "Content-Type", "application/json" });
+                        response.body = R"({ "operation":"Continue", "nextHeartbeatIntervalMs":1000 })";
+                        return response;
+                    });
+                    startHeartbeating(agent);
+
+                    Assert::IsTrue(agent.waitForRequests(2, std::chrono::seconds(10)), L"Verify the GSDK kept heartbeating.");
+                    for (const TestHttpServer::Request &heartbeat : agent.getRequests())
+                    {
+                        Assert::AreEqual(std::string("application/json"), heartbeat.header("Accept"), L"Verify MessagePack is not offered.");
+                        Assert::AreEqual(std::string("application/json; charset=utf-8"), heartbeat.header("Content-Type"), L"Verify heartbeats are sent as JSON.");
+                    }
+                }
+
+                TEST_METHOD(HeldHeartbeatFollowedStraightAway)
+                {
+                    TestHttpServer agent([](const TestHttpServer::Request &request)
+                    {
+                        TestHttpServer::Response response = longPollResponse(request);
+                        response.holdMs = 1500;
+                        return response;
+                    });
+                    startHeartbeating(agent);
+                    GSDKInternal::m_instance->setState(GameState::StandingBy);
+
+                    // The agent asks for 10 second intervals, so only the re-arm gets three heartbeats in this time
+                    Assert::IsTrue(agent.waitForRequests(3, std::chrono::seconds(8)), L"Verify held heartbeats are followed straight away.");
+                    std::vector<TestHttpServer::Request> heartbeats = agent.getRequests();
+                    Assert::AreEqual(std::string("wait=30"), heartbeats[0].header("Prefer"), L"Verify StandingBy heartbeats ask to be held.");
+                    for (size_t i = 1; i < heartbeats.size(); ++i)
+                    {
+                        auto gapMs = std::chrono::duration_cast<std::chrono::milliseconds>(heartbeats[i].receivedAt - heartbeats[i - 1].receivedAt).count();
+                        Assert::IsTrue(gapMs >= 1500 && gapMs < 2000, L"Verify the next heartbeat is sent once the held one is answered.");
+                    }
+                }
+
+                TEST_METHOD(EarlyAnsweredLongPollsKeepMinimumInterval)
+                {
+                    TestHttpServer agent(longPollResponse);
+                    startHeartbeating(agent);
+                    GSDKInternal::m_instance->setState(GameState::StandingBy);
+
+                    Assert::IsTrue(agent.waitForRequests(4, std::chrono::seconds(8)), L"Verify long polls answered early are still followed straight away.");
+                    std::vector<TestHttpServer::Request> heartbeats = agent.getRequests();
+                    for (size_t i = 1; i < heartbeats.size(); ++i)
+                    {
+                        auto gapMs = std::chrono::duration_cast<std::chrono::milliseconds>(heartbeats[i].receivedAt - heartbeats[i - 1].receivedAt).count();
+                        Assert::IsTrue(gapMs >= 900, L"Verify long polls are sent no more often than the minimum heartbeat interval.");
+                    }
+                }
+
+                TEST_METHOD(HeldHeartbeatTimesOutAfterWaitAndGrace)
+                {
+                    setEnvironmentVariable("GSDK_HEARTBEAT_LONG_POLL_SECONDS", "1");
+                    TestHttpServer agent([](const TestHttpServer::Request &request)
+                    {
+                        TestHttpServer::Response response = longPollResponse(request);
+                        response.holdMs = 60000;
+                        return response;
+                    });
+                    startHeartbeating(agent);
+                    GSDKInternal::m_instance->setState(GameState::StandingBy);
+
+                    Assert::IsTrue(agent.waitForHangUp(0, std::chrono::seconds(10)), L"Verify the GSDK gives up on an agent that holds too long.");
+                    TestHttpServer::Request heartbeat = agent.getRequests()[0];
+                    auto heldMs = std::chrono::duration_cast<std::chrono::milliseconds>(heartbeat.hungUpAt - heartbeat.receivedAt).count();
+                    Assert::AreEqual(std::string("wait=1"), heartbeat.header("Prefer"), L"Verify the wait comes from the environment.");
+                    Assert::IsTrue(heldMs >= 5500 && heldMs < 7000, L"Verify the held heartbeat waits one second plus the five second grace.");
+                }
+
+                TEST_METHOD(ShutdownAbandonsHeldHeartbeat)
+                {
+                    TestHttpServer agent([](const TestHttpServer::Request &request)
+                    {
+                        TestHttpServer::Response response = longPollResponse(request);
+                        response.holdMs = 60000;
+                        return response;
+                    });
+                    startHeartbeating(agent);
+                    GSDKInternal::m_instance->setState(GameState::StandingBy);
+                    Assert::IsTrue(agent.waitForRequests(1, std::chrono::seconds(5)), L"Verify the StandingBy heartbeat was sent.");
+
+                    auto shutdownStart = std::chrono::steady_clock::now();
+                    GSDKInternal::m_instance.reset();
+                    auto shutdownMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - shutdownStart).count();
+
+                    Assert::IsTrue(shutdownMs < 3000, L"Verify shutting down doesn't wait out the 30 second hold.");
+                    Assert::IsTrue(agent.waitForHangUp(0, std::chrono::seconds(1)), L"Verify the held heartbeat was abandoned.");
+                }
+
             private:
                 Json::Value parseJson(std::string jsonStr)
                 {
@@ -413,6 +953,44 @@ namespace Microsoft
                     Assert::IsTrue(parsedSuccessfully, L"Encoded json state should decode as valid json.");
                     return json;
                 }
+
+                void startHeartbeating(TestHttpServer &agent)
+                {
+                    auto config = std::make_unique<TestConfig>(agent.getEndpoint(), "serverId", "logFolder", "sharedContentFolder");
+                    config->setShouldHeartbeat(true);
+                    GSDKInternal::testConfiguration = std::move(config);
+                    GSDK::start();
+                }
+
+                // A long-polling agent that asks for 10 second intervals, so only held heartbeats explain quicker ones
+                static TestHttpServer::Response longPollResponse(const TestHttpServer::Request &request)
+                {
+                    TestHttpServer::Response response;
+                    if (!request.header("Prefer").empty())
+                    {
+                        response.headers.push_back({ "Preference-Applied", request.header("Prefer") });
+                    }
+                    response.headers.push_back({ "Content-Type", "application/json" });
+                    response.body = R"({ "operation":"Continue", "nextHeartbeatIntervalMs":10000 })";
+                    return response;
+                }
+
+                // An empty value removes the variable
+                static void setEnvironmentVariable(const char *name, const char *value)
+                {
+#ifdef _WIN32
+                    _putenv_s(name, value);
+#else
+                    if (*value == '\0')
+                    {
+                        unsetenv(name);
+                    }
+                    else
+                    {
+                        setenv(name, value, 1);
+                    }
+#endif
+                }
             };
         }
     }
@@ -0,0 +1,226 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+
+#ifdef ENABLE_PLAYFABENTITY_API
+
+#include <playfab/PlayFabEntityFiles.h>
+
+#include "TestHttpServer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <set>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using Microsoft::Azure::Gaming::TestHttpServer;
+
+namespace PlayFab
+{
+    TEST_CLASS(PlayFabEntityFilesTests)
+    {
+    public:
+        TEST_METHOD_CLEANUP(RemoveTestFiles)
+        {
+            std::remove(c_downloadPath);
+            std::remove(c_uploadPath);
+        }
+
+        TEST_METHOD(DownloadSplitIntoRangesInParallel)
+        {
+            const std::string blob = makeBlob(1000000);
+            TestHttpServer server([&blob](const TestHttpServer::Request& request) { return serveBlob(request, blob); });
+
+            PlayFabFileTransferSettings settings;
+            settings.downloadChunkSize = 256 * 1024;
+            settings.maxParallelChunks = 4;
+
+            Assert::IsTrue(runDownload(server, blob.size(), settings), L"Verify the download succeeds.");
+            Assert::IsTrue(blob == readFile(c_downloadPath), L"Verify the ranges were written at their offsets.");
+
+            std::set<std::string> ranges;
+            for (const auto& request : server.getRequests())
+            {
+                ranges.insert(request.header("Range"));
+            }
+            std::set<std::string> expected = { "bytes=0-262143", "bytes=262144-524287", "bytes=524288-786431", "bytes=786432-999999" };
+            Assert::IsTrue(expected == ranges, L"Verify the file was fetched as one range per chunk, with a short last range.");
+        }
+
+        TEST_METHOD(DownloadResumesAfterDroppedRange)
+        {
+            const std::string blob = makeBlob(600000);
+            std::atomic<bool> dropped(false);
+            TestHttpServer server([&blob, &dropped](const TestHttpServer::Request& request)
+            {
+                TestHttpServer::Response response = serveBlob(request, blob);
+                if (request.header("Range") == "bytes=262144-524287" && !dropped.exchange(true))
+                {
+                    response.dropAfterBytes = 100000;
+                }
+                return response;
+            });
+
+            PlayFabFileTransferSettings settings;
+            settings.downloadChunkSize = 256 * 1024;
+
+            Assert::IsTrue(runDownload(server, blob.size(), settings), L"Verify the download survives a dropped connection.");
+            Assert::IsTrue(blob == readFile(c_downloadPath), L"Verify the resumed range completed the file.");
+
+            size_t resumed = 0;
+            for (const auto& request : server.getRequests())
+            {
+                if (request.header("Range") == "bytes=362144-524287")
+                {
+                    ++resumed;
+                }
+            }
+            Assert::AreEqual(size_t(4), server.getRequests().size(), L"Verify only the dropped range was requested again.");
+            Assert::AreEqual(size_t(1), resumed, L"Verify the retry picked up from the last byte received.");
+        }
+
+        TEST_METHOD(DownloadFailsWhenServerIgnoresRanges)
+        {
+            const std::string blob = makeBlob(600000);
+            TestHttpServer server([&blob](const TestHttpServer::Request&)
+            {
+                TestHttpServer::Response response;
+                response.body = blob;
+                return response;
+            });
+
+            PlayFabFileTransferSettings settings;
+            settings.downloadChunkSize = 256 * 1024;
+            PlayFabError error;
+
+            Assert::IsFalse(runDownload(server, blob.size(), settings, &error), L"Verify whole-file answers to ranged requests are not written at the range offsets.");
+            Assert::AreEqual(416, error.HttpCode, L"Verify the error says ranges are not supported.");
+            Assert::IsFalse(std::ifstream(c_downloadPath).good(), L"Verify the partial file was removed.");
+        }
+
+        TEST_METHOD(DownloadStaysUnderCombinedRateCap)
+        {
+            const std::string blob = makeBlob(2 * 1024 * 1024);
+            TestHttpServer server([&blob](const TestHttpServer::Request& request) { return serveBlob(request, blob); });
+
+            PlayFabFileTransferSettings settings;
+            settings.downloadChunkSize = 512 * 1024;
+            settings.maxParallelChunks = 4;
+            settings.maxBytesPerSecond = 512 * 1024;
+
+            // Four seconds at the cap, less what curl reads in its first burst. Each range held to the whole cap would take under one.
+            auto start = std::chrono::steady_clock::now();
+            Assert::IsTrue(runDownload(server, blob.size(), settings), L"Verify the capped download succeeds.");
+            auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+            Assert::IsTrue(blob == readFile(c_downloadPath), L"Verify the capped download is complete.");
+            Assert::IsTrue(elapsedMs >= 2000, L"Verify the parallel ranges share the cap instead of each getting all of it.");
+        }
+
+        TEST_METHOD(UploadStreamsMappedFileAndRetriesFromStart)
+        {
+            const std::string blob = makeBlob(300000);
+            std::ofstream(c_uploadPath, std::ios::binary) << blob;
+
+            std::atomic<int> attempts(0);
+            TestHttpServer server([&attempts](const TestHttpServer::Request&)
+            {
+                TestHttpServer::Response response;
+                response.status = (attempts++ == 0) ? 503 : 201;
+                return response;
+            });
+
+            PlayFabFileTransferSettings settings;
+            PlayFabError error;
+            Assert::IsTrue(PlayFabEntityFiles::UploadFile("http://" + server.getEndpoint() + "/blob?sig=secret", c_uploadPath, settings, error), L"Verify the upload succeeds on its second attempt.");
+
+            auto requests = server.getRequests();
+            Assert::AreEqual(size_t(2), requests.size(), L"Verify the transient failure was retried once.");
+            for (const auto& request : requests)
+            {
+                Assert::AreEqual(std::string("PUT"), request.method, L"Verify the blob is sent in one PUT.");
+                Assert::AreEqual(std::string("BlockBlob"), request.header("x-ms-blob-type"), L"Verify the blob type header.");
+                Assert::IsTrue(blob == request.body, L"Verify every attempt sends the whole mapped file.");
+            }
+        }
+
+        TEST_METHOD(UploadStopsOnPermanentFailure)
+        {
+            std::ofstream(c_uploadPath, std::ios::binary) << makeBlob(1000);
+            TestHttpServer server([](const TestHttpServer::Request&)
+            {
+                TestHttpServer::Response response;
+                response.status = 403;
+                return response;
+            });
+
+            PlayFabFileTransferSettings settings;
+            PlayFabError error;
+            Assert::IsFalse(PlayFabEntityFiles::UploadFile("http://" + server.getEndpoint() + "/blob?sig=secret", c_uploadPath, settings, error), L"Verify the upload fails.");
+
+            Assert::AreEqual(size_t(1), server.getRequests().size(), L"Verify a permanent failure is not retried.");
+            Assert::AreEqual(403, error.HttpCode, L"Verify the status is reported.");
+            Assert::AreEqual(std::string("http://" + server.getEndpoint() + "/blob"), error.UrlPath, L"Verify the signature is kept out of the error.");
+        }
+
+    private:
+        static constexpr const char* c_downloadPath = "entityFilesDownload.bin";
+        static constexpr const char* c_uploadPath = "entityFilesUpload.bin";
+
+        static std::string makeBlob(size_t size)
+        {
+            std::mt19937 random(static_cast<unsigned int>(size));
+            std::string blob(size, '\0');
+            for (char& c : blob)
+            {
+                c = static_cast<char>(random());
+            }
+            return blob;
+        }
+
+        static std::string readFile(const char* path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        // Answers "bytes=first-last" and "bytes=first-" ranges the way blob storage does
+        static TestHttpServer::Response serveBlob(const TestHttpServer::Request& request, const std::string& blob)
+        {
+            TestHttpServer::Response response;
+            std::string range = request.header("Range");
+            if (range.compare(0, 6, "bytes=") != 0)
+            {
+                response.body = blob;
+                return response;
+            }
+
+            char* rangeEnd = nullptr;
+            size_t first = strtoull(range.c_str() + 6, &rangeEnd, 10);
+            size_t last = (rangeEnd[1] == '\0') ? blob.size() - 1 : (std::min)(static_cast<size_t>(strtoull(rangeEnd + 1, nullptr, 10)), blob.size() - 1);
+            response.status = 206;
+            response.headers.push_back({ "Content-Range", "bytes " + std::to_string(first) + "-" + std::to_string(last) + "/" + std::to_string(blob.size()) });
+            response.body = blob.substr(first, last - first + 1);
+            return response;
+        }
+
+        static bool runDownload(TestHttpServer& server, size_t size, const PlayFabFileTransferSettings& settings, PlayFabError* outError = nullptr)
+        {
+            EntityModels::GetFileMetadata metadata;
+            metadata.FileName = "blob";
+            metadata.DownloadUrl = "http://" + server.getEndpoint() + "/blob?sig=secret";
+            metadata.Size = static_cast<Int32>(size);
+
+            bool downloaded = false;
+            PlayFabEntityFiles::RunDownload(metadata, c_downloadPath, settings,
+                [&downloaded](const EntityModels::GetFileMetadata&, void*) { downloaded = true; },
+                [outError](const PlayFabError& error, void*) { if (outError != nullptr) *outError = error; },
+                nullptr);
+            return downloaded;
+        }
+    };
+}
+
+#endif